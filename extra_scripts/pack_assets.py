@@ -0,0 +1,129 @@
+#
+# extra_scripts/pack_assets.py
+#
+# Packs the WebPs in lib/assets into the image for the "assets" partition,
+# read by src/asset_store.c. Little endian:
+#
+#   header   magic "TBA1", u32 count, u32 crc32 of the entries, u32 reserved
+#   entries  count x (char name[20], u32 offset, u32 len, u32 crc32)
+#   data     each asset 4 byte aligned, offsets from the partition start
+#
+# Names are the file names without .webp. As a PlatformIO pre script it
+# packs into the build dir, adds the image to `upload` and provides an
+# `uploadassets` target that flashes only the assets. Standalone:
+#
+#   python extra_scripts/pack_assets.py lib/assets assets.bin
+#
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b"TBA1"
+NAME_LEN = 20
+LABEL = "assets"
+
+
+def pack(src_dir, out_path, max_size=None):
+    names = sorted(f for f in os.listdir(src_dir) if f.endswith(".webp"))
+    blobs = []
+    for name in names:
+        with open(os.path.join(src_dir, name), "rb") as f:
+            blobs.append((name[: -len(".webp")].encode(), f.read()))
+
+    entries = b""
+    data = b""
+    offset = 16 + 32 * len(blobs)
+    for name, blob in blobs:
+        if len(name) >= NAME_LEN:
+            raise ValueError(f"asset name too long: {name.decode()}")
+        entries += struct.pack(
+            "<20sIII", name, offset + len(data), len(blob), zlib.crc32(blob)
+        )
+        data += blob + b"\0" * (-len(blob) % 4)
+
+    image = struct.pack("<4sIII", MAGIC, len(blobs), zlib.crc32(entries), 0)
+    image += entries + data
+    if max_size is not None and len(image) > max_size:
+        raise ValueError(f"{len(image)} bytes of assets, partition holds {max_size}")
+    with open(out_path, "wb") as f:
+        f.write(image)
+    return len(image)
+
+
+def parse_size(text):
+    scale = {"K": 1024, "M": 1024 * 1024}.get(text[-1:].upper(), 1)
+    return int(text[:-1] if scale > 1 else text, 0) * scale
+
+
+def partition(csv_path, label):
+    """(offset, size) of a partition, working out offsets left blank."""
+    next_off = 0
+    with open(csv_path) as f:
+        for line in f:
+            row = [c.strip() for c in line.split("#")[0].split(",")]
+            if len(row) < 5 or not row[0]:
+                continue
+            align = 0x10000 if row[1] == "app" else 0x1000
+            off = int(row[3], 0) if row[3] else -(-next_off // align) * align
+            size = parse_size(row[4])
+            if row[0] == label:
+                return off, size
+            next_off = off + size
+    return None
+
+
+def find_csv(proj_dir, name):
+    path = os.path.join(proj_dir, name)
+    if os.path.exists(path):
+        return path
+    # Board manifests don't always match the file's case
+    folder, base = os.path.split(path)
+    for f in os.listdir(folder) if os.path.isdir(folder) else []:
+        if f.lower() == base.lower():
+            return os.path.join(folder, f)
+    return None
+
+
+def platformio(env):
+    import click
+
+    proj_dir = env.subst("$PROJECT_DIR")
+    build_dir = env.subst("$BUILD_DIR")
+    src_dir = os.path.join(proj_dir, "lib", "assets")
+    out = os.path.join(build_dir, "assets.bin")
+
+    csv = find_csv(proj_dir, env.BoardConfig().get("build.partitions", ""))
+    part = partition(csv, LABEL) if csv else None
+    if not part:
+        click.secho("No assets partition, assets won't be flashed", fg="yellow")
+        return
+
+    os.makedirs(build_dir, exist_ok=True)
+    size = pack(src_dir, out, part[1])
+    click.secho(f"Packed {size} bytes of assets for 0x{part[0]:x}", fg="cyan")
+    env.Append(FLASH_EXTRA_IMAGES=[(f"0x{part[0]:x}", out)])
+    # Same port, speed and chip as the stock upload target
+    mcu = env.BoardConfig().get("build.mcu", "esp32")
+    env.AddCustomTarget(
+        "uploadassets",
+        None,
+        [
+            env.VerboseAction(
+                env.AutodetectUploadPort, "Looking for upload port..."
+            ),
+            f'"$PYTHONEXE" "$UPLOADER" --chip {mcu} --port "$UPLOAD_PORT" '
+            f'--baud $UPLOAD_SPEED write_flash 0x{part[0]:x} "{out}"',
+        ],
+        title="Upload assets",
+        description="Flash only the assets partition",
+    )
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(f"usage: {sys.argv[0]} <assets dir> <out.bin>")
+    print(f"{pack(sys.argv[1], sys.argv[2])} bytes")
+else:
+    Import("env")  # noqa: F821, SCons provides it
+    platformio(env)  # noqa: F821
@@ -1,28 +0,0 @@
-#pragma once
-
-#include <stddef.h>
-#include <stdint.h>
-
-// boot / no-apps screen
-extern const uint8_t ASSET_NOAPPS_WEBP[];
-extern const size_t ASSET_NOAPPS_WEBP_LEN;
-
-// OTA progress frames
-extern const uint8_t ASSET_OTA_PROG_0_WEBP[];
-extern const size_t ASSET_OTA_PROG_0_LEN;
-
-extern const uint8_t ASSET_OTA_PROG_25_WEBP[];
-extern const size_t ASSET_OTA_PROG_25_LEN;
-
-extern const uint8_t ASSET_OTA_PROG_50_WEBP[];
-extern const size_t ASSET_OTA_PROG_50_LEN;
-
-extern const uint8_t ASSET_OTA_PROG_75_WEBP[];
-extern const size_t ASSET_OTA_PROG_75_LEN;
-
-extern const uint8_t ASSET_OTA_PROG_100_WEBP[];
-extern const size_t ASSET_OTA_PROG_100_LEN;
-
-// other assets
-// extern const uint8_t ASSET_LAZY_DADDY_MP3[];
-// extern const size_t ASSET_LAZY_DADDY_MP3_LEN;
\ No newline at end of file
@@ -1,1448 +0,0 @@
-// Generated by 'tbt dev firmware-asset', don't edit manually!
-#include <stddef.h>
-#include <stdint.h>
-const size_t ASSET_NOAPPS_WEBP_LEN = 24530;
-const uint8_t ASSET_NOAPPS_WEBP[] =
-    "\x52\x49\x46\x46\xCA\x5F\x00\x00\x57\x45\x42\x50\x56\x50\x38\x58\x0A"
-    "\x00\x00\x00\x12\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x41\x4E\x49\x4D"
-    "\x06\x00\x00\x00\xFF\xFF\xFF\xFF\x00\x00\x41\x4E\x4D\x46\x26\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00"
-    "\x56\x50\x38\x4C\x0E\x00\x00\x00\x2F\x3F\xC0\x07\x00\x07\x10\x11\xFD"
-    "\x0F\x44\x44\xFF\x03\x41\x4E\x4D\x46\x26\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x0E"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\x07\x10\x11\xFD\x0F\x44\x44\xFF\x03"
-    "\x41\x4E\x4D\x46\x26\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x0E\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\x07\x10\x11\xFD\x0F\x44\x44\xFF\x03\x41\x4E\x4D\x46\x48"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00"
-    "\x00\x00\x56\x50\x38\x4C\x2F\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20"
-    "\x10\x48\x52\x9F\x7C\x0D\x01\x41\xD1\x75\xCB\x09\x08\x8A\xAE\x5B\x6E"
-    "\xFE\x03\x7F\x15\x10\x09\x90\x38\xCD\x69\xAC\x97\x6C\x8B\xE8\xFF\x04"
-    "\xE4\xC5\xA8\x2A\xD4\x08\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38"
-    "\x4C\x34\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x16\x4C\xA6\x9C\xFF"
-    "\x91\x86\x90\x20\xE1\xB2\xFF\x83\x42\x82\x84\xCB\xFE\x0F\xCE\x7F\xE0"
-    "\xAF\x02\x35\x01\x08\x30\xA2\x89\xA6\xFD\xFA\x7C\x11\xFD\x9F\x00\xBC"
-    "\x50\x16\xE7\x64\x0D\x03\x41\x4E\x4D\x46\x4E\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C"
-    "\x36\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x10\x48\xF2\xB7\x9A\x6C"
-    "\x0D\x81\x40\x92\xBF\xD5\x64\x0B\x04\x92\xFC\xAD\x26\x7B\xFE\x03\x7F"
-    "\x15\x28\x6A\xDB\x88\x29\xB4\x42\x2B\xFB\xDB\xE3\x19\xD1\xFF\x09\xC0"
-    "\x97\xCB\xC4\x74\x32\x35\x0A\x41\x4E\x4D\x46\x4E\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38"
-    "\x4C\x36\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x10\x48\xF2\xB7\x9D"
-    "\x60\x0D\x81\x40\x92\xBF\xED\x04\x0B\x04\x92\xFC\x6D\x27\x78\xFE\x03"
-    "\x7F\x15\x28\x6A\xDB\x88\x29\xB4\x42\x2B\xFB\xDB\xE3\x19\xD1\xFF\x09"
-    "\xC0\x17\xCB\xC4\x74\x32\x0D\x0A\x41\x4E\x4D\x46\x38\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1F\x00\x00\x00\x2F\x3F\xC0\x07\x00\x0F\x30\xFF\xF3\x3F\xFF"
-    "\xF3\x1F\x78\x50\xD3\xB6\x01\x13\xE8\xC5\x3F\xEF\x88\xFE\x4F\x00\x4F"
-    "\xCA\xA6\x2C\x00\x41\x4E\x4D\x46\x38\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x1F\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x00\x0F\x30\xFF\xF3\x3F\xFF\xF3\x1F\x78\x50"
-    "\xD3\xB6\x01\x13\xE8\xC5\x3F\xEF\x88\xFE\x4F\x00\x0F\xCA\xA6\x34\x00"
-    "\x41\x4E\x4D\x46\x4E\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x35\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\x17\x20\x10\x48\xF2\xB7\x9C\x64\x0D\x81\x40\x92\xBF\xE5"
-    "\x24\x0B\x04\x92\xFC\x2D\x27\x79\xFE\x03\x7F\x15\xA8\x09\x80\x84\x21"
-    "\x1A\xD1\x68\x8F\xDB\x37\xA2\xFF\x13\x80\x2F\xCB\x62\x39\x59\x8F\x04"
-    "\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x34\x00\x00\x00\x2F"
-    "\x3F\xC0\x07\x00\x17\x20\x16\x4C\xA6\x9C\xFF\x91\x86\x90\x20\xE1\xB2"
-    "\xFF\x83\x42\x82\x84\xCB\xFE\x0F\xCE\x7F\xE0\xAF\x02\x35\x01\x90\x30"
-    "\x44\x23\x1A\xED\x71\xFB\x46\xF4\x7F\x02\xF0\x45\x59\x2C\x27\xEB\xD1"
-    "\x41\x4E\x4D\x46\x4A\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x32\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\x17\x20\x10\x48\xF2\xB7\x9B\x68\x0D\x81\x40\x92\xBF\xDD"
-    "\x44\x0B\x04\x92\xFC\xED\x26\x7A\xFE\x03\x7F\x15\x10\x09\x90\x38\xCD"
-    "\x69\xBC\x27\x6A\x8C\xE8\xFF\x04\x64\x45\x54\x15\xEA\x88\x41\x4E\x4D"
-    "\x46\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2A\x00\x00\x00\x56\x50\x38\x4C\x34\x00\x00\x00\x2F\x3F\xC0\x07\x00"
-    "\x17\x20\x10\x48\x52\xDC\x1F\x66\x0D\x81\x40\x92\xE2\xFE\x30\x0B\x04"
-    "\x92\x14\xF7\x87\x79\xFE\x03\x7F\x15\x90\x49\xDB\x4C\xDA\xA4\xD5\x7D"
-    "\xBF\xB1\x33\xA2\xFF\x13\x90\xD5\x51\x55\xA8\x63\x02\x41\x4E\x4D\x46"
-    "\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29"
-    "\x00\x00\x00\x56\x50\x38\x4C\x34\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17"
-    "\x20\x10\x48\x42\xD9\x5F\x72\x0D\x81\x40\x12\xCA\xFE\x92\x0B\x04\x92"
-    "\x50\xF6\x97\x7C\xFE\x03\x7F\x15\x90\x49\xDB\x4C\xDA\xA4\xD5\x7D\xBF"
-    "\xB1\x33\xA2\xFF\x13\x90\xD5\x51\x55\xA8\x63\x02\x41\x4E\x4D\x46\x4C"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00"
-    "\x00\x00\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20"
-    "\x10\x48\x52\xD8\x1F\x76\x0D\x81\x40\x92\xC2\xFE\xB0\x0B\x04\x92\x14"
-    "\xF6\x87\x7D\xFE\x03\x7F\x15\x90\x49\xDB\x54\x5A\xA5\xCD\xFD\xBE\xB1"
-    "\x33\xA2\xFF\x13\xC0\xEA\xA9\xE4\xB5\x00\x00\x41\x4E\x4D\x46\x4C\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00"
-    "\x00\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x10"
-    "\x48\x52\xD8\x1F\x76\x0D\x81\x40\x92\xC2\xFE\xB0\x0B\x04\x92\x14\xF6"
-    "\x87\x7D\xFE\x03\x7F\x15\x90\x49\xDB\x54\x5A\xA5\xCD\xFD\xBE\xB1\x33"
-    "\xA2\xFF\x13\xC0\xEA\xA9\xE4\xB5\x00\x00\x41\x4E\x4D\x46\x4C\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00"
-    "\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x10\x48"
-    "\x52\xD8\x1F\x76\x0D\x81\x40\x92\xC2\xFE\xB0\x0B\x04\x92\x14\xF6\x87"
-    "\x7D\xFE\x03\x7F\x15\x90\x49\xDB\x54\x5A\xA5\xCD\xFD\xBE\xB1\x33\xA2"
-    "\xFF\x13\xC0\xEA\xA9\xE4\xB5\x00\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x10\x48\x52"
-    "\xD8\x1F\x76\x0D\x81\x40\x92\xC2\xFE\xB0\x0B\x04\x92\x14\xF6\x87\x7D"
-    "\xFE\x03\x7F\x15\x90\x49\xDB\x54\x5A\xA5\xCD\xFD\xBE\xB1\x33\xA2\xFF"
-    "\x13\xC0\xEA\xA9\xE4\xB5\x00\x00\x41\x4E\x4D\x46\x36\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1D\x00\x00\x00\x2F\x3F\xC0\x07\x00\x0F\x30\xFF\xF3\x3F\xFF"
-    "\xF3\x1F\x78\x20\x9B\xB4\xF1\xF4\xFC\x0F\xED\x1C\xD1\xFF\xB4\x90\x67"
-    "\x00\x00\x41\x4E\x4D\x46\x36\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x1D\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\x0F\x30\xFF\xF3\x3F\xFF\xF3\x1F\x78\x20\x9B\xB4"
-    "\xF1\xF4\xFC\x0F\xED\x1C\xD1\xFF\xB4\x94\x47\x00\x00\x41\x4E\x4D\x46"
-    "\x36\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A"
-    "\x00\x00\x00\x56\x50\x38\x4C\x1D\x00\x00\x00\x2F\x3F\xC0\x07\x00\x0F"
-    "\x30\xFF\xF3\x3F\xFF\xF3\x1F\x78\x20\x9B\xB4\xF1\xF4\xFC\x0F\xED\x1C"
-    "\xD1\xFF\xB4\x94\x47\x00\x00\x41\x4E\x4D\x46\x36\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38"
-    "\x4C\x1D\x00\x00\x00\x2F\x3F\xC0\x07\x00\x0F\x30\xFF\xF3\x3F\xFF\xF3"
-    "\x1F\x78\x20\x9B\xB4\xF1\xF4\xFC\x0F\xED\x1C\xD1\xFF\xB4\x98\x27\x00"
-    "\x00\x41\x4E\x4D\x46\x36\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x1D\x00\x00\x00\x2F"
-    "\x3F\xC0\x07\x00\x0F\x30\xFF\xF3\x3F\xFF\xF3\x1F\x78\x20\x9B\xB4\xF1"
-    "\xF4\xFC\x0F\xED\x1C\xD1\xFF\xB4\x9C\x07\x00\x00\x41\x4E\x4D\x46\x4A"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00"
-    "\x00\x00\x56\x50\x38\x4C\x31\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20"
-    "\x10\x48\xDA\xDF\x79\x0E\x01\x49\x62\xFF\x3F\x87\x80\x24\xB1\xFF\x9F"
-    "\x63\xFE\x03\x2B\x3F\x28\x6A\xDB\x06\x0A\xB4\x42\x2B\xFE\xEE\x7C\x46"
-    "\xF4\x3F\xF9\x82\x49\x8B\x2B\x00\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x16\x4C\x76"
-    "\xE6\x2F\x9C\x86\x90\x20\xA1\xFB\x7F\xAF\x42\x82\x84\xEE\xFF\xBD\xCE"
-    "\x7F\xE0\xAF\x02\x32\x69\x9B\x4A\x9B\xB4\xB9\xEF\x37\x76\x46\xF4\x7F"
-    "\x02\x78\x65\x94\xAF\x1A\x1E\x00\x41\x4E\x4D\x46\x4A\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50"
-    "\x38\x4C\x32\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x10\x48\xDA\x1F"
-    "\x78\x15\x21\x41\x82\xFF\x1F\x9B\x84\x04\x09\xFE\xBF\x6C\x98\xFF\xC0"
-    "\xCA\x0F\x64\xD2\x36\x95\x36\x69\x73\xDF\x6F\xEC\x8C\xE8\xFF\x04\xF0"
-    "\xD2\xA8\xAA\xE1\x01\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x34"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\x17\x20\x16\x4C\xF6\xE5\x2F\x19\x93"
-    "\x58\x30\xD9\x9D\xBF\x66\x0E\x62\xC1\x64\x77\xFE\xA8\x01\xCC\x7F\x60"
-    "\xE5\x07\x32\x69\x9B\x4A\x9B\xB4\xB9\xEF\x37\x76\x46\xF4\x7F\x02\x78"
-    "\x69\x54\xD5\xF0\x41\x4E\x4D\x46\x4E\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x36\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x00\x1F\x20\x10\x20\x58\xF4\xFF\x61\x45\x48"
-    "\x40\x70\xD4\xFF\x0D\x92\x90\x80\x60\xAE\xFF\x55\x98\xFF\x00\xAA\x7E"
-    "\x15\x90\x89\x60\x88\x26\x9A\x68\xDA\xFD\xE6\x8C\x11\xFD\x9F\x00\xBD"
-    "\xD2\x28\xA8\x68\x78\x41\x4E\x4D\x46\x50\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x37"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\x1F\x20\x24\x20\x34\x7F\x8D\xB6\x49"
-    "\x48\x40\xC8\x46\x7B\xEC\x83\x90\x80\x90\x2D\x37\xD8\x80\xF9\x0F\xA0"
-    "\xEA\x57\x01\x99\x08\x86\x68\xA2\x89\xA6\xDD\x6F\xCE\x18\xD1\xFF\x09"
-    "\xD0\x2B\x8D\x82\x8A\x86\x07\x00\x41\x4E\x4D\x46\x5E\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50"
-    "\x38\x4C\x46\x00\x00\x00\x2F\x3F\xC0\x07\x00\x27\x40\x90\x6D\xB3\xD1"
-    "\xCC\xE7\xFE\x1E\x57\x21\xCC\x36\xDA\x88\x66\x74\xFE\x0C\xF7\x22\xD2"
-    "\xB6\xD9\x54\x4D\xD3\xFD\xD3\x83\xF9\x0F\xA0\xEA\xBF\x6D\x2A\x30\xD3"
-    "\x30\x0D\x12\x90\x80\x04\x24\xE0\xDF\x59\xBF\x65\x57\x44\xFF\x27\x40"
-    "\xDF\xD0\x58\xB0\x62\xC3\x0E\x1E\x41\x4E\x4D\x46\x5C\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50"
-    "\x38\x4C\x44\x00\x00\x00\x2F\x3F\xC0\x07\x00\x27\x20\x10\x20\x53\x2A"
-    "\x7C\x39\xA1\x90\x6D\x04\x38\x36\x8D\x7B\xE0\x2E\x47\x26\x6D\x53\x1B"
-    "\x7D\x6B\x68\x66\xE6\x9F\xF9\x0F\xA0\x52\x3F\x9B\x37\x30\xD3\x30\x0D"
-    "\x12\x90\x80\x04\x24\xE0\xDF\x59\xBF\x65\x57\x44\xFF\x27\x40\xDF\xD0"
-    "\xD8\xB0\x60\xC5\x0E\x1E\x41\x4E\x4D\x46\x66\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C"
-    "\x4E\x00\x00\x00\x2F\x3F\xC0\x07\x00\x2F\xA0\xA8\x8D\x14\x38\xB8\x16"
-    "\x4E\xBE\x68\x41\x12\x8A\x02\x90\x81\xA3\x2A\x08\xE0\xAB\x0F\x3B\x08"
-    "\x02\x48\x93\x29\x64\xB0\xC1\x0A\x8B\x3C\xFF\x01\x90\xD4\xE5\xD6\x35"
-    "\x8A\xFF\x81\xA1\xC8\x36\x44\x10\x41\x04\x11\x44\xD0\xBF\xD1\xDE\xB8"
-    "\x45\xF4\x7F\x02\xE2\xDB\x93\x2D\x2B\xD6\x6C\xD8\xC1\x03\x41\x4E\x4D"
-    "\x46\x64\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2A\x00\x00\x00\x56\x50\x38\x4C\x4B\x00\x00\x00\x2F\x3F\xC0\x07\x00"
-    "\x2F\x40\x16\x60\x9A\xDC\xB7\x3B\x97\x08\x12\x89\x2C\xC0\x34\x39\x81"
-    "\xDD\x81\x44\x11\x41\x0A\xDA\x46\x81\x73\xE7\xE1\xC5\x09\x08\x62\xFE"
-    "\x03\xB0\x3D\xFB\x53\x4A\xC6\xB7\x60\x28\xB2\x0D\x11\x44\x10\x41\x04"
-    "\x11\xF4\x6F\xB4\x37\x6E\x11\xFD\x9F\x80\xF8\xF6\x64\xCB\x8A\x35\x1B"
-    "\x76\xF0\x00\x41\x4E\x4D\x46\x6E\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x55\x00\x00"
-    "\x00\x2F\x3F\xC0\x07\x00\x37\x40\x26\x60\xB1\x4F\xFF\x0E\x42\xC9\xE0"
-    "\x23\x8D\x42\x46\x92\x98\xF3\xE7\x6A\xEF\xF1\x00\x8D\x80\x48\xC3\xE4"
-    "\xFD\x33\x91\x03\x8D\xA6\x00\x8A\x6D\xFE\x03\xF0\x7F\xA6\x6D\xAA\x1D"
-    "\xC2\xA4\x04\x68\x22\x49\x0D\x12\x90\x80\x04\x24\x20\x01\x09\xF8\x77"
-    "\xB2\x5D\xD2\x45\xF4\x7F\x02\xE2\x37\x1F\x4B\xB6\x6C\x58\xB3\x62\x0F"
-    "\x1E\x00\x41\x4E\x4D\x46\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x59\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\x37\x60\xA6\x01\x12\x46\xFF\x42\xF4\xE1\x07\xF5"
-    "\x37\x87\x9A\xB6\x8D\xA0\xF2\xC7\xF8\xDD\x8D\x5D\x8F\xC0\x29\x69\x23"
-    "\x09\xDA\xEF\xFC\xAB\x3B\x7A\x78\x45\x1C\x98\xFF\x00\xD0\xFB\xC4\xF3"
-    "\x57\xF7\x23\x2D\x76\x01\x4D\x24\xA9\x41\x02\x12\x90\x80\x04\x24\x20"
-    "\x01\xFF\x4E\xB6\x4B\xBA\x88\xFE\x4F\x40\xFC\xE6\x63\xC9\x9A\x2D\x1B"
-    "\x56\xEC\xC1\x03\x00\x41\x4E\x4D\x46\x74\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x5C"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\x3F\xA0\x28\x00\x19\xC8\x5F\x12\xE9"
-    "\x65\x50\x46\x80\x1D\x5D\xC8\x34\x20\xBC\xA6\x7F\x2F\xA7\x04\x02\x98"
-    "\x00\x8A\xDB\x46\x52\xB6\xFF\x3A\xF7\xCB\x78\x28\xCD\x7F\x00\x70\xF6"
-    "\xD9\xE8\xEF\xD8\xA5\x74\x52\x48\x08\xD0\x44\x92\x1A\x24\x20\x01\x09"
-    "\x48\x40\x02\x12\x22\x21\xFE\x1D\x6C\x97\x74\x11\xFD\x9F\x80\xF8\xAD"
-    "\x87\x25\x1B\x76\xD9\xB2\x66\xC5\x1E\x3C\x41\x4E\x4D\x46\x7C\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00"
-    "\x56\x50\x38\x4C\x63\x00\x00\x00\x2F\x3F\xC0\x07\x00\x47\xA0\xA8\x6D"
-    "\x24\x67\xF9\x63\x5B\x02\x4B\xA0\xF7\xE7\x1D\x12\x45\x8D\x24\x29\xEB"
-    "\xDF\xCB\xDA\xA2\x27\x1E\x83\xD2\x46\x52\xA0\x3B\xE8\xBF\x38\x5A\x40"
-    "\xFD\x16\x49\xE6\x3F\x00\xF0\xAF\xC7\xE4\x42\x14\x7D\x7A\xED\x9C\xAD"
-    "\xD1\x80\x68\x60\x18\xB2\x95\x8F\x10\x42\x08\x21\x84\x10\x42\x08\x21"
-    "\xA4\xFF\x8E\xFF\x16\xD1\xFF\x09\x90\x1B\x13\x0B\xAC\xB0\xC7\x0E\x5B"
-    "\x6C\xB0\x96\x1B\x05\x00\x41\x4E\x4D\x46\x7E\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C"
-    "\x66\x00\x00\x00\x2F\x3F\xC0\x07\x00\x47\xA0\xA6\x91\x14\x38\x7C\xDD"
-    "\xF1\xE3\x00\x0D\xB4\x58\x40\x4D\x23\x29\x70\xF8\xEA\x3B\xDE\x16\x01"
-    "\x38\xC0\x0A\x8A\xDA\x46\x72\xB3\xAB\x7D\xF6\x7E\x14\x0E\xC0\x41\xBA"
-    "\xF9\x0F\x00\xDE\x7D\x33\xCF\xFE\xD5\x7D\xB8\x19\x92\xFC\x96\x74\x04"
-    "\x45\x01\x40\x46\x22\x88\x20\x82\x08\x22\x88\x20\x82\x08\xEA\xDF\xDB"
-    "\x33\xA2\xFF\x13\x00\xBF\x3D\xDA\x79\x1A\xA6\x51\x1A\xA7\x49\x9A\xA6"
-    "\x59\xDA\x87\x07\x41\x4E\x4D\x46\x7E\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x66\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x00\x4F\x60\x34\x00\x19\xFF\xBF\x26\x4A\xA2"
-    "\xA6\x2E\x4A\x7B\x43\x69\x00\x20\x0D\xFF\x9F\xC2\x4B\x24\xFA\x5E\x6A"
-    "\xD3\x4C\x00\x32\x12\xE8\x9F\x45\x13\x1F\x01\xF6\x7A\x37\xFF\x01\xC0"
-    "\xFF\x2F\x5C\x74\xDA\x9B\x9D\xB9\x3C\xC2\xA8\x98\x49\x80\x28\xB2\x95"
-    "\x10\x81\x08\x44\x20\x82\x11\x8C\x60\x04\x23\x18\xC1\xDA\x7B\xE3\x18"
-    "\xD1\xFF\x09\x88\x69\x2E\x96\xAC\xD8\x67\x8F\x5D\x76\xD8\x66\x8B\x35"
-    "\x1B\x78\x41\x4E\x4D\x46\x84\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x6C\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\x4F\xA0\x26\x00\x90\x86\x9B\xFE\x35\xE8\x41\x0E"
-    "\x0A\x70\xED\xA1\x35\x14\xB4\x91\xA4\x9C\x7F\x55\xA7\xE1\x44\x3C\x33"
-    "\xF3\x2B\x04\x00\xB4\x49\x22\x7F\xA2\x20\x52\xF8\x6F\x67\xFE\x03\x00"
-    "\xFE\xFF\x11\x89\xDD\xA3\x5A\xB0\x22\x50\x11\x46\xA4\x9E\x09\x23\x40"
-    "\x14\xD9\x4A\x88\x40\x04\x22\x18\xC1\x08\x46\x20\x82\x11\x8C\x60\xED"
-    "\xBD\x71\x8C\xE8\xFF\x04\xC4\xB4\x36\x4B\xD6\xCC\x7F\xF6\xD8\x65\x87"
-    "\x6D\xB6\x58\xB1\x81\x07\x41\x4E\x4D\x46\x82\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C"
-    "\x6A\x00\x00\x00\x2F\x3F\xC0\x07\x00\x4F\xA0\x16\x92\x24\x68\x6D\x96"
-    "\x7F\x55\x8E\xE2\xE2\xCB\xFE\xD3\x50\x14\x00\x84\x23\x90\xE2\x02\x69"
-    "\xE1\xB5\xB9\x69\x24\x00\x12\xFE\x3F\xE4\x00\x54\x12\x6A\x72\xFE\x03"
-    "\x80\xFF\x9F\xB8\x7A\x9F\xEC\xCA\x2C\x23\x09\x35\x17\x22\x06\x14\x03"
-    "\x00\x1A\x85\x10\x42\x08\x21\x84\x30\x84\x21\x0C\x61\x08\x69\xDF\xF5"
-    "\x8C\xE8\xFF\x04\xC0\xB4\xD5\x0C\xCD\xD4\x2C\xFF\x6F\xF6\xCC\xAE\xD9"
-    "\x31\x13\x33\x36\x23\xB3\x85\x07\x41\x4E\x4D\x46\x82\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50"
-    "\x38\x4C\x6A\x00\x00\x00\x2F\x3F\xC0\x07\x00\x4F\xA0\xA8\x91\x24\x35"
-    "\xB9\xBC\xAF\x23\x15\x4C\x4E\x4E\x49\x00\xA0\x6D\x96\x7F\x15\x09\xB0"
-    "\xC8\xB5\x99\x9A\x00\x20\xD8\xAC\xBD\x5E\x97\x4B\x05\xA9\xCC\x7F\x00"
-    "\xC0\xF7\x4E\xDD\x57\x66\x85\x6E\xEB\x0F\xAF\x22\x6A\xC4\xD4\xBF\x04"
-    "\xC5\x00\x80\x46\x21\x84\x10\x42\x08\x21\x84\x30\x84\x21\x0C\x61\xDA"
-    "\xDD\x3D\x23\xFA\x3F\x01\xD0\x6D\x34\xFB\x66\x68\xD6\x5F\x32\x63\x33"
-    "\x31\x53\xB3\x63\x76\xCD\x9E\xD9\xC2\x03\x41\x4E\x4D\x46\x7A\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00"
-    "\x56\x50\x38\x4C\x62\x00\x00\x00\x2F\x3F\xC0\x07\x00\x47\xA0\x10\x92"
-    "\x24\xE7\xFC\x71\xCE\xE5\x44\x72\xFE\xD7\x50\xD0\xB6\x91\x73\xFC\x91"
-    "\x1C\xA2\x03\xB2\xF7\xBF\xD9\x06\x64\xFC\xFF\xA8\x49\x6C\xB4\x93\xF9"
-    "\x0F\x00\xFC\x7F\x90\xEA\xFF\x99\x79\x95\x41\x28\x1E\xC6\x4C\x50\x4D"
-    "\xDB\xAA\x74\x11\x42\x08\x21\x84\x10\x42\x08\x21\x84\xF4\x87\x37\xFE"
-    "\x45\xF4\x7F\x02\x70\x9A\x84\xD7\x99\x65\x51\xE6\x65\x56\xA6\x65\x52"
-    "\xC6\xF8\x8D\x00\x41\x4E\x4D\x46\x76\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x5E\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x00\x47\xA0\x28\x00\x19\x48\xFF\x3A\xAA\x68"
-    "\xE2\x65\x67\x0D\x05\x6D\xDB\x30\xE5\x0F\xA4\xA0\xC6\xE3\x5F\xB5\x6D"
-    "\xDB\x30\xFE\xFF\xD7\x36\xA7\xCE\x7F\x00\xF8\xFF\x28\xED\x6E\x4C\xB5"
-    "\xE9\x22\x52\x32\xAC\x04\xD5\xB4\xAD\x4A\x17\x21\x84\x10\x42\x08\x21"
-    "\x84\x10\x42\x48\x7F\x78\xE3\x5F\x44\xFF\x27\x00\x6B\x25\xBC\xEF\x2C"
-    "\x8B\x32\x2F\xB3\x32\x2D\x93\x32\xC6\x6F\x04\x41\x4E\x4D\x46\x76\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00"
-    "\x00\x56\x50\x38\x4C\x5E\x00\x00\x00\x2F\x3F\xC0\x07\x00\x47\xA0\x90"
-    "\x91\x24\xE6\xFC\x75\x8E\xE5\x54\xBE\x17\x0D\x05\x01\xC8\x30\xFA\x17"
-    "\xD1\x49\x11\xFB\x53\xDB\xB6\x0D\xE3\xFF\x8F\x75\xA6\x5E\xE7\x3F\x00"
-    "\xFC\x7F\x54\xFB\x19\xFF\xAF\x3B\x89\x94\xA9\xCC\x02\xAA\x69\x5B\x95"
-    "\x2E\x42\x08\x21\x84\x10\x42\x08\x21\x84\x90\xFE\xF0\xC6\xBF\x88\xFE"
-    "\x4F\x00\x16\x4A\x78\xE2\x59\x16\x65\x5E\x66\x65\x5A\x26\x65\x8C\xDF"
-    "\x08\x41\x4E\x4D\x46\x70\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x58\x00\x00\x00\x2F"
-    "\x3F\xC0\x07\x00\x3F\xA0\x90\x91\x24\xE6\xFC\x75\xCE\xE5\x5C\xCA\x17"
-    "\x0D\x05\x6D\xDB\x30\xE5\xCF\xA3\xA4\xCA\xE4\xEC\xA8\x0D\x40\x86\xF1"
-    "\xFF\xB3\x8C\xA4\xCE\x7F\x00\xF8\xFF\xA8\x76\x37\x26\x4D\xA4\x8C\xD9"
-    "\x02\x35\x01\x40\x30\x34\x11\x41\x04\x11\x44\x10\x41\xFF\x06\x9B\x33"
-    "\xA2\xFF\x13\x00\x6B\xC4\xB0\x37\xF4\x30\x0B\xD3\x30\x09\xE3\x30\x2A"
-    "\xF7\xF0\x41\x4E\x4D\x46\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x5A\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\x3F\xA0\x90\x91\x24\xE6\xFC\x75\x4E\xE5\x64\xCA"
-    "\x17\x0D\x05\x6D\xDB\x30\xE5\xCF\xA3\xA4\xCA\xE4\xEC\xA8\x6D\xDB\x86"
-    "\xF1\xFF\xCF\x7A\x72\x7A\x99\xFF\x00\xF0\xFF\x51\xED\x67\xFC\x3F\x91"
-    "\x66\x83\x2D\x50\x13\x00\x04\x43\x13\x11\x44\x10\x41\x04\x11\xF4\x6F"
-    "\xB0\x39\x23\xFA\x3F\x01\x70\x63\x0C\xDB\xB4\x87\x59\x98\x86\x49\x18"
-    "\x87\x51\xB9\x87\x07\x41\x4E\x4D\x46\x6C\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x54"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\x37\xA0\x90\x8D\x24\x68\xFD\x75\xD6"
-    "\x65\x61\xBE\x3B\x0D\x85\x6C\x23\x40\xE7\xCF\x71\x54\xA7\xF2\x2A\x6C"
-    "\xDB\x06\xE9\xFF\xEF\x76\x8C\xF3\x1F\x00\xFE\x1F\xD5\x6E\x43\xA4\xDA"
-    "\x39\x01\xAA\x22\xDB\xA0\xAE\x26\x22\x88\x20\x82\x08\xFA\x37\x79\xF3"
-    "\x19\xD1\xFF\x09\xC0\x0F\x52\xD8\x26\x3D\xCC\xC2\x34\x4C\xC2\xB8\xBD"
-    "\x87\x07\x41\x4E\x4D\x46\x6C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x53\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\x37\xA0\x90\x6D\x04\x68\xFE\x3A\xE7\x72\x34\x9F"
-    "\x86\x42\xB6\x11\xA0\xF9\x8B\x9C\xD3\xB1\x7C\x0A\xDB\xB6\x41\xFA\xFF"
-    "\xBD\xED\x18\xE6\x3F\x00\xFF\x27\xB7\x67\x58\xD4\x96\x34\x40\x55\x64"
-    "\x1B\xD4\x8D\x20\x82\x08\x22\x88\x20\x82\xFE\x4D\xDE\x7C\x46\xF4\x7F"
-    "\x02\xF0\xC3\x14\xD6\xA9\x87\x59\x98\x86\x49\x18\xB7\xF7\xF0\x00\x41"
-    "\x4E\x4D\x46\x68\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F"
-    "\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x50\x00\x00\x00\x2F\x3F\xC0"
-    "\x07\x00\x2F\xA0\x90\x6D\x04\x68\xFE\x3A\x07\x73\x32\x9F\x86\x42\xB6"
-    "\x11\xA0\xF3\xE7\x38\xAA\x53\x79\xD5\xB6\x6D\xC3\xF8\xFF\x6F\x3D\x95"
-    "\xD4\xF9\x0F\x80\xFF\x93\x9A\x49\xDD\x89\x05\x8A\xDA\x48\x81\x76\x9D"
-    "\x20\x01\x09\x48\xC0\xBF\xA3\x1B\x9E\x11\xFD\x9F\x00\x3C\x31\xC3\x1A"
-    "\xF5\x30\x0B\xD3\x30\x19\xEF\xE1\x01\x41\x4E\x4D\x46\x66\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\x4D\x00\x00\x00\x2F\x3F\xC0\x07\x00\x2F\xA0\x90\x6D\x04"
-    "\x68\xFE\x3A\x83\x39\x9A\x47\x43\x21\xDB\x08\xD0\xFC\x3D\x26\x75\x2E"
-    "\x8F\x9A\xB6\x0D\x98\xF2\xC7\xDB\x6B\xCF\x7F\x00\xFE\x67\x2C\xD2\x16"
-    "\xAD\x40\x51\x1B\x29\xD0\xAE\x13\x24\x20\x01\x09\xF8\x77\x74\xC3\x33"
-    "\xA2\xFF\x13\x80\x27\x67\x58\x62\x0F\xB3\x30\x0D\x93\xF1\x1E\x1E\x00"
-    "\x41\x4E\x4D\x46\x66\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x4D\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\x2F\x40\x90\x6D\x33\x7F\x9D\xC9\x5C\xE6\x99\x86\x42\xB6"
-    "\x11\xA0\xF9\x8B\xCC\xE9\x5C\x1E\x85\x6D\xDB\x20\xFD\xFF\x60\x1A\xCE"
-    "\x7F\x00\xF6\x67\xDA\xA4\xDA\xBE\x03\x45\x8D\xA4\x30\x27\x01\x09\x48"
-    "\x40\x02\x12\xF0\xEF\xA8\x97\x5F\x44\xFF\x27\x00\x4F\x48\x08\x6B\x6E"
-    "\xEA\x26\x6E\xDC\xC0\x37\x02\x00\x41\x4E\x4D\x46\x64\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50"
-    "\x38\x4C\x4B\x00\x00\x00\x2F\x3F\xC0\x07\x00\x2F\x40\x90\x6D\x33\x7F"
-    "\x9D\xC9\x9C\xE6\xD3\x20\xC8\xB6\x99\xBF\xC8\x9C\x0E\xB3\x2B\x6C\xDB"
-    "\x06\xE9\xFF\x07\xD3\x70\xFE\x03\xB0\x3F\xD7\x26\xD5\x79\x03\x8A\x1A"
-    "\x49\x61\x4E\x02\x12\x90\x80\x04\x24\xE0\xDF\x51\x2F\xBF\x88\xFE\x4F"
-    "\x00\x9E\x90\x10\xD6\xDC\xD4\x4D\xDC\xB8\x81\x6F\x04\x00\x41\x4E\x4D"
-    "\x46\x5E\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2A\x00\x00\x00\x56\x50\x38\x4C\x45\x00\x00\x00\x2F\x3F\xC0\x07\x00"
-    "\x27\x20\x10\x20\xFC\xEF\x98\x71\x63\x83\x40\xD2\x66\xFD\x8B\xAC\xD3"
-    "\xBA\x9C\x2B\x6C\xDB\x06\xE9\xFF\x07\xD3\x70\xFE\x03\xF0\x3F\x6B\x49"
-    "\xAF\x41\x31\x24\x49\xCC\xAE\xC9\x21\x1C\xC2\xF9\x9B\xE5\xF0\x8B\xE8"
-    "\xFF\x04\xE0\x0B\x89\xA8\xE6\xA6\xE9\xA4\x81\x6F\x04\x00\x41\x4E\x4D"
-    "\x46\x5C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2A\x00\x00\x00\x56\x50\x38\x4C\x44\x00\x00\x00\x2F\x3F\xC0\x07\x00"
-    "\x27\x20\x10\x20\xFC\xEF\x98\x71\x63\x83\x20\xDB\x66\xFE\x22\x73\x1A"
-    "\xCC\xAF\xB0\x6D\x1B\xA4\xFF\x1F\x4C\xC3\xF9\x0F\xC0\xFF\xAC\x25\xBD"
-    "\x03\xC5\x90\x24\x31\xBB\x26\x87\x70\x08\xE7\x6F\x96\xC3\x2F\xA2\xFF"
-    "\x13\x80\x2F\x24\xA2\x9A\x9B\xA6\x93\x06\xBE\x11\x41\x4E\x4D\x46\x56"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00"
-    "\x00\x00\x56\x50\x38\x4C\x3E\x00\x00\x00\x2F\x3F\xC0\x07\x00\x1F\x20"
-    "\x10\x20\xFC\xEF\x98\x71\x63\x43\x20\x40\xF8\x1F\xF1\x64\x86\xC2\xB6"
-    "\x6D\x90\xFE\x7F\x30\x0D\xE7\x3F\x00\xFF\x59\x4B\x82\xA2\xB6\x6D\xA0"
-    "\x40\x2B\xB4\x41\x1B\xBC\x7B\xFB\x46\xF4\x7F\x02\xF8\xA0\x88\xF4\x72"
-    "\xD6\xE0\x8B\x00\x41\x4E\x4D\x46\x56\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x3E\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x00\x1F\x20\x10\x20\xFC\xEF\x98\x71\x63\x43"
-    "\x20\x40\xF8\x1F\xF1\x64\x86\xC2\xB6\x6D\x90\xFE\x7F\x30\x0D\xE7\x3F"
-    "\x00\xFF\x59\x4B\x82\xA2\xB6\x6D\xA0\x40\x28\xE4\x41\x1B\xBC\x7B\xFB"
-    "\x46\xF4\x7F\x02\x78\xA1\x08\xF4\x72\xD6\xE0\x8B\x00\x41\x4E\x4D\x46"
-    "\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A"
-    "\x00\x00\x00\x56\x50\x38\x4C\x48\x00\x00\x00\x2F\x3F\xC0\x07\x00\x27"
-    "\x40\x90\x6D\x33\x7F\x90\x09\x4C\xE6\x36\xD7\x20\xCC\x36\x9A\xBF\xC8"
-    "\xBE\xE3\x39\x99\x53\x10\x80\x0C\x23\x9A\xFE\x81\xD8\xDF\xFC\x07\xE0"
-    "\xFF\x5A\x9B\x62\x04\x45\x6D\xA4\x40\x23\x05\x09\x48\x00\xFF\xCE\x6E"
-    "\xF8\x45\xF4\x7F\x02\x78\x44\x73\x22\x6A\x79\xD2\xC0\x37\x02\x41\x4E"
-    "\x4D\x46\x6C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x54\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\x3F\xA0\x90\x91\x24\xE6\x00\xCE\x1F\xAC\x7C\xA1\xF9\xD7\x50\x08"
-    "\x00\x0D\x13\x40\xFE\x0A\x31\xC5\x72\x36\x32\x01\x8B\xFD\x1A\xE8\x1F"
-    "\x4A\x12\x27\xF3\x1F\x00\xFF\xEF\x3A\xA4\x8C\x03\x07\xC5\x56\x05\x45"
-    "\x8D\xA4\x30\x27\x02\x03\x88\xC0\x0F\x12\xF0\xEF\xA0\x97\x5F\x44\xFF"
-    "\x27\x00\xBF\x48\x2C\x4E\x80\x95\xA7\xED\x1D\x3C\x41\x4E\x4D\x46\x68"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00"
-    "\x00\x00\x56\x50\x38\x4C\x4F\x00\x00\x00\x2F\x3F\xC0\x07\x00\x2F\x40"
-    "\x16\x60\xB2\x73\x28\x7D\xC9\xE4\xAF\x92\x86\xA2\xB6\x6D\xA0\xFE\x8B"
-    "\xA0\xD0\xAE\xF1\x87\x31\x22\x01\x12\x2A\x4E\xF1\x7F\xF6\x9A\xF3\x1F"
-    "\x80\xFF\x93\xAA\x6A\x37\x71\x40\x4D\x00\xA0\x09\x1A\x00\x2A\x10\x81"
-    "\xFE\x01\x65\xFA\x45\xF4\x7F\x02\xE0\x33\x66\xB8\x59\x09\x08\x54\xCF"
-    "\xD3\xED\x3D\x78\x00\x41\x4E\x4D\x46\x82\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x6A"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\x4F\xA0\xA6\x91\x14\xE8\xDC\x9D\x9C"
-    "\xF3\x88\x01\x5A\x4A\x2C\xBC\x35\x36\xCC\x34\x40\x42\x05\xE8\xFF\x33"
-    "\xA2\xD0\xC2\xD7\xD3\x04\xAA\x69\x1B\x89\xB9\xF9\xC1\x34\x3C\xCF\x1F"
-    "\x40\x5F\x6F\xFE\x03\xC0\x7F\xAA\x2B\xB6\x22\xFC\xBC\xE9\x86\x52\x85"
-    "\x0C\x8A\x82\x9A\x48\xB6\x9A\xFB\xC4\x1A\x09\x38\x43\x06\x12\x28\x91"
-    "\x9D\x53\x17\xD1\xFF\x09\xE0\x33\x96\xEC\xA1\x86\xD8\x0E\x43\xEF\xF9"
-    "\xF4\x36\x92\x6D\xF5\xE0\x01\x41\x4E\x4D\x46\x90\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38"
-    "\x4C\x77\x00\x00\x00\x2F\x3F\xC0\x07\x00\x57\xA0\x26\x00\x08\x49\x02"
-    "\x0D\xCC\xFA\x0F\x4A\x68\x61\xD3\xE0\x77\x57\x43\x4D\x00\x20\x0D\x19"
-    "\xB8\xA1\x7F\x0B\x5A\xEC\x77\x68\x0C\x14\xB5\x6D\x03\xB5\x38\xAA\x51"
-    "\x1C\xC9\x8B\xC3\x78\xF4\xBF\xF9\x0F\x00\xFC\xF7\x88\x83\x94\x58\x17"
-    "\xFC\xAB\xF5\xB8\x50\xA0\x29\x19\x5F\x02\x9B\xC8\xB6\x5A\x1D\x92\x80"
-    "\xE8\x07\x37\xD8\xA0\xC4\x02\x1D\x62\xE1\xE7\xD8\x45\xF4\x7F\x02\xF8"
-    "\x17\x4B\x6D\x80\x82\x68\xCD\x36\x74\x00\xC9\x8E\x83\x5D\xF7\x4B\xF7"
-    "\x91\xB7\xFA\xE2\x01\x00\x41\x4E\x4D\x46\xA6\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C"
-    "\x8E\x00\x00\x00\x2F\x3F\xC0\x07\x00\x6F\xA0\x24\xB6\xAD\xE8\x7F\xBB"
-    "\x75\xF8\x09\xF6\x02\xF4\x77\x38\x34\x21\xB0\xD4\x50\x0B\x00\x6C\x13"
-    "\x81\x18\xCC\x37\x14\x01\x2A\x58\x61\x2A\x31\x29\xB6\x9A\x00\x40\x1A"
-    "\x7A\xF0\x71\x11\x03\x47\x00\x53\x98\xDB\xDF\x6F\x6F\x9D\xFF\x00\x80"
-    "\xFF\x7F\x7B\xA1\x5B\x83\x93\x1B\x20\xE7\x4D\x81\xCE\xBC\x2C\xF6\x88"
-    "\x46\xB2\x92\x37\x68\x91\x45\x60\x1B\xD9\xB6\x92\xF7\xDD\x0D\xAB\x83"
-    "\x12\xE8\x8A\x94\x90\x56\xA8\xD3\x5D\xB2\x88\xFE\x4F\x00\xFC\x8A\x5D"
-    "\xDF\x8E\xF0\xA8\x4A\x7C\x03\x68\x60\xCC\x46\x1B\x4F\xED\xB9\x5F\x7D"
-    "\x21\x76\xB7\xC1\x6D\xB3\xD4\xC0\x67\x0E\x41\x4E\x4D\x46\xA2\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00"
-    "\x56\x50\x38\x4C\x8A\x00\x00\x00\x2F\x3F\xC0\x07\x00\x6F\xA0\x26\x00"
-    "\xD0\x84\x8B\x86\x54\xA5\xC6\x1A\xB8\x7B\x00\xAD\xA1\x28\xB6\x0D\x4A"
-    "\x05\x3B\x1D\x94\x17\x41\x13\x63\xAB\xC1\x9F\xDA\x48\x36\x28\xBF\x5C"
-    "\x21\x5E\x31\x4A\x16\xEA\x42\x28\x52\x83\xF9\x0F\x00\xFA\xFF\x89\x75"
-    "\x38\x20\xBD\xB8\x68\x94\x2F\x8A\x59\x78\x36\xAD\xAA\x10\x39\xB0\x26"
-    "\x65\x03\x6C\x22\xDB\x6A\xF5\x04\x10\xFB\x28\x01\x09\x98\xC0\x07\x12"
-    "\x28\x51\x40\x8D\x04\xA4\xE0\x29\xFC\x1C\xBB\x88\xFE\x4F\x00\xFC\x89"
-    "\x31\xF9\xCE\x4C\x04\x47\x6B\xA0\x42\x6F\x27\x5B\x8E\xF6\xDC\xCF\x5D"
-    "\x48\xD9\x2D\xE4\x6D\x96\x36\xF8\xCE\x01\x41\x4E\x4D\x46\xB6\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00"
-    "\x56\x50\x38\x4C\x9D\x00\x00\x00\x2F\x3F\xC0\x07\x00\xA7\xC0\x26\x00"
-    "\x80\x34\xB8\x04\xA1\x0D\x29\x89\xC1\xC5\xC5\x4B\x12\xD7\xF9\x6A\x30"
-    "\x0D\x00\x20\x0D\x2E\x91\xFF\x2F\x22\xF9\x01\x24\x67\xBE\x68\x0C\x02"
-    "\x00\x48\x42\xC7\x00\x6E\x30\xA7\xBF\x33\xA1\xC1\x8E\xF9\x0F\x00\xC0"
-    "\xFF\xFF\x31\x22\x20\x02\x48\x29\x71\xCE\xD9\xBA\x59\x17\xA1\xEE\xCC"
-    "\x5F\xB7\xF7\x4F\xDA\x73\xD1\x73\xC8\x47\x13\x23\xC5\xB2\x74\x13\xCD"
-    "\xA9\x4F\xD0\xD1\x4A\x8A\x31\x06\xD8\x46\x92\xD4\x68\xD0\x9A\x97\xF9"
-    "\x87\x8B\x34\x71\x22\xFA\x3F\x01\x1C\x89\xB5\xD6\x94\x5A\xEC\x08\x2D"
-    "\xFC\xAF\x27\xC0\x43\xB3\x1B\x01\x46\xB1\x4E\x1C\x33\xBB\x63\xCB\x30"
-    "\x46\x6E\xF7\x6D\x77\xC3\xBB\xD7\x95\x0B\x07\x22\x00\x41\x4E\x4D\x46"
-    "\xB0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A"
-    "\x00\x00\x00\x56\x50\x38\x4C\x97\x00\x00\x00\x2F\x3F\xC0\x07\x00\x35"
-    "\x30\xAD\xB5\x6D\xC9\x97\xFF\xCC\x42\x6C\xC0\x30\x4C\xC1\x28\x44\x97"
-    "\x64\xDD\x36\x20\xDB\x0C\xA4\xDF\x23\xF6\xFE\x4C\x6A\xDB\xAA\xB4\x13"
-    "\x50\x03\x87\x24\x09\xF1\x7E\x19\x90\xD4\x00\x49\x0D\xD6\xA8\x11\x4C"
-    "\x63\xDB\x6A\x74\x67\xA8\x04\x15\x1D\x3A\x4A\x3C\x3D\xD0\x0A\x25\x82"
-    "\xA3\x86\xB0\xEB\xFB\x3F\x01\x84\x1B\xE2\xB2\x8E\x73\x71\xF6\x10\x59"
-    "\x52\x50\x33\x3C\x55\x84\x81\x15\x17\xA0\x0A\x88\xBE\x4E\x10\x1E\x53"
-    "\x51\xE3\xC3\x03\x41\xAB\x44\x58\x9A\x1A\xDD\x12\x2D\x6C\x48\x62\x15"
-    "\x0B\xC0\x61\xBF\xB0\x86\x5F\x4F\x69\xDD\x3C\x1C\x01\xCD\xDD\x76\x4D"
-    "\xF5\x3F\xCF\xDA\xF6\x24\xDC\x12\x01\x00\x41\x4E\x4D\x46\xCE\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00"
-    "\x56\x50\x38\x4C\xB5\x00\x00\x00\x2F\x3F\xC0\x07\x00\xBF\xC0\x26\x00"
-    "\xC0\x24\x73\x1F\x12\x41\x43\x40\x28\xC2\x72\xF2\xB9\xDB\xED\x35\xD4"
-    "\x44\xB2\xD5\x90\x29\x79\xF4\x39\xC8\x42\x16\xEA\x70\x40\x07\x02\x02"
-    "\x9B\x00\x00\xD2\xE0\x70\x79\x08\xAA\x10\x93\x2C\x7E\x91\xC4\xB6\x00"
-    "\x36\xFF\x01\x08\xF8\xFF\x5F\x41\xA4\x6A\x6E\x1F\xA6\x92\x0B\x60\x60"
-    "\xD9\x7A\x58\x61\x7C\xAF\x13\x05\xA3\xED\xE2\x1B\x65\x3D\xDE\xC0\x90"
-    "\xF3\x26\xE7\xBE\x25\xEE\x41\x53\x94\xF7\x47\x60\x9D\x0B\x43\xAB\x83"
-    "\x14\x9A\x81\x95\x6D\x5B\x49\x1E\x61\x07\xB6\xF3\x1F\x2B\x0D\x9F\xD6"
-    "\x35\xA2\xFF\x13\x40\x97\xC3\x16\x90\x70\xE0\x81\xC6\x65\xD7\x14\x53"
-    "\x21\x80\x12\xAE\xA1\xE6\x95\xA2\xBA\x15\x81\x62\xBB\x1D\x59\x08\x27"
-    "\xFB\x90\xCD\x64\xA9\x80\x2D\x8F\xD3\x52\x03\x5D\x1E\xF6\xA6\xFF\xE9"
-    "\xAA\x08\x00\x41\x4E\x4D\x46\xC4\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\xAC\x00\x00"
-    "\x00\x2F\x3F\xC0\x07\x00\x35\xB8\xAD\x6D\x5B\x89\x7E\x09\x58\x21\x94"
-    "\x40\x51\x14\x40\x4C\x48\x4C\x6C\xA9\x7B\x01\x8C\xFB\xF4\x60\x35\x10"
-    "\x7D\xCF\x46\xDF\x67\x52\xDB\x56\xA5\x5D\x81\x45\x08\x1C\x9A\x20\xA4"
-    "\x20\x13\x8B\x10\x28\x72\x80\x9C\x0C\xA3\x7E\x5A\x49\x6C\x5B\xD1\xED"
-    "\xF2\xDD\x1F\xD4\xE6\x08\x80\xA7\xC3\xDA\x84\x26\x34\x02\x47\x08\x06"
-    "\xDF\xFF\x09\x40\x78\x33\xBC\xAE\xA7\x54\x59\x02\x10\xEC\x73\x64\x33"
-    "\x3D\xF6\x12\x7B\x1A\x26\xCE\xC3\x0C\xA0\x02\xF0\xFF\x82\x40\x8A\xD3"
-    "\x40\x36\xDE\xCB\x02\x02\x5F\xB2\xA0\x0D\xCC\x0C\xB2\x10\x36\x04\x72"
-    "\x6B\xC6\x88\x9D\xA5\x44\x84\x8F\xA6\x48\xB7\x19\x0A\xD0\x5D\x57\xAE"
-    "\x7D\x37\x08\x70\xDB\x5B\x0E\x07\x98\x6D\xFF\xCF\x73\x14\xC8\xB9\x03"
-    "\xE6\xB5\x1D\x41\x4E\x4D\x46\xF4\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xDC\x00\x00"
-    "\x00\x2F\x3F\xC0\x07\x00\xFF\xC0\x36\x00\xC0\x32\xD1\xE4\xAC\xEA\x19"
-    "\x3D\xBE\x5F\x18\x3B\x66\x9B\x6F\xB0\x0D\x00\xB0\x4C\x9C\xD4\x7A\xB3"
-    "\x97\x9A\x93\x8D\x4D\xB3\x18\x05\x00\x60\xE6\x34\x5B\x15\xD4\x80\xFD"
-    "\xFF\x0A\xC0\xAF\xED\xCD\x7F\x00\x00\xFE\xFF\x2F\x05\xB2\xEE\x2E\x3D"
-    "\xBB\xC8\x6E\x14\x62\x26\x82\x73\xD5\x5F\xA3\xAF\xB7\xAC\xE5\x69\x7E"
-    "\x6C\x8A\x19\x22\x67\x06\xDC\x17\xB5\x75\x61\x13\xD3\x0E\x6D\xF7\x1C"
-    "\xF1\xEE\x7B\x9E\x47\x5E\xE4\xFA\xA3\x57\x43\x88\x0E\xA5\xFF\xFF\x19"
-    "\x49\x70\xA3\xC2\xAF\xB7\x1A\xD1\xBB\x62\x4F\x3B\x37\x0C\x8E\x1B\x49"
-    "\x52\xA4\x59\x66\x66\xF6\xDF\xD0\x1E\xDC\xDD\x83\x57\x4D\x44\xFF\x27"
-    "\x80\xFD\xC1\x0F\x3A\x25\x80\x67\x29\x97\xE8\xF8\x82\xA6\xE6\x1A\x1D"
-    "\x2B\x00\x14\xE0\xA4\x04\x5B\x86\x9D\x47\x26\x57\x25\x67\x83\x6A\xAE"
-    "\x92\x38\xF8\xFA\x53\x95\xCF\x33\x11\x19\xB0\x72\xCC\x97\x46\x74\x0E"
-    "\xC4\x1C\xEA\x65\x45\x66\xA5\xD6\xB2\x67\x5E\x8C\x0B\x8D\xFB\x97\x04"
-    "\x41\x4E\x4D\x46\xFE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xE5\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\x07\xC1\x36\xB2\x6D\x25\xDF\x5D\xB2\x8F\x54\x4A\x99\x0C"
-    "\x39\x43\xE6\x2E\x91\xB7\xC1\x34\x00\x80\x34\x68\xA2\x71\x84\xFE\x4E"
-    "\xE7\x08\x1A\x1F\xCC\xDD\x5D\xD9\x04\x00\x98\x64\x3E\xDC\x3A\x68\x0D"
-    "\xD2\x52\x81\x0E\x5C\x24\x70\x77\xBB\x74\xFE\x03\x00\xF0\xFF\x7F\x05"
-    "\xD0\x34\x6B\xE9\x4A\x45\x69\x4E\x51\xFB\x79\xFF\x1B\xFC\x63\x46\x0A"
-    "\xBC\xB9\x60\x42\x2C\x38\x74\x89\x04\xA6\x48\xEE\x37\x2C\xB2\xE9\x33"
-    "\x50\x33\x6E\x1D\x56\xFB\xB4\xFB\xBE\xCF\x3A\xAC\x86\x7A\xC0\x02\x55"
-    "\xF1\x54\x5B\xB4\xCE\xE5\x94\x45\x85\xEF\x7B\x95\xDE\x42\x41\x24\x38"
-    "\x9F\xC1\x95\x24\xC9\x4A\x84\xBB\xBB\xC3\xFD\xEF\x39\x02\xEB\xFB\xD5"
-    "\x44\xF4\x7F\x02\x8C\xBF\xD7\xF6\xE1\xEA\x87\xBB\x76\x08\xD8\x37\x61"
-    "\xE9\xB8\x59\x2A\x19\x4D\x1E\x70\x80\x56\x4A\x80\x5C\x20\xE7\x2C\x3A"
-    "\x05\x4E\xE7\xAC\xC4\xC6\xBB\xA0\xC3\xD8\x09\x1F\x28\x1F\x83\xF6\x80"
-    "\x88\xD1\x4C\x8F\x11\x33\xFA\xF9\x01\x82\xF8\x86\xFA\xA0\xF1\x49\x56"
-    "\x0F\xD7\x3D\xDC\xEF\x14\x00\x41\x4E\x4D\x46\x00\x01\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38"
-    "\x4C\xE7\x00\x00\x00\x2F\x3F\xC0\x07\x00\xFF\xC0\x36\x00\xC0\x32\x31"
-    "\x26\xAC\xA9\x3D\xE9\xFD\xDE\xD3\x03\x6C\xBE\xC1\x34\x00\xC0\x24\x73"
-    "\x1F\x2E\x0F\xF8\xFF\x99\x43\x88\x4E\xD2\xE4\x81\x69\x6D\xED\x4D\xD2"
-    "\x8B\xEA\xC9\x26\x19\x22\xEB\xC6\xA1\x38\x6C\xC0\x41\xE3\xD0\xBD\x17"
-    "\x33\xFF\x01\x00\xA8\x3D\x4D\xB9\x8A\xF1\x0D\x42\x88\x30\xBD\xFD\xCE"
-    "\xA8\x13\x33\xBB\x67\xF2\xF9\xDD\xB3\xD7\x34\x05\xFF\x7B\x32\xB1\xB2"
-    "\x6B\x77\x8E\x82\x5D\xA8\x05\x34\x4A\x40\xF5\xE7\xEA\xEF\xA2\xA5\x7D"
-    "\x5C\x17\x21\x74\xD2\x86\xBB\xA0\xAE\x14\x6E\x4D\xBB\xD2\x59\xB6\x86"
-    "\xF5\x23\xB2\x4E\x70\x0E\x14\xAC\x24\x49\x32\xB5\xCF\xB6\x7D\xFF\x83"
-    "\xCE\x3C\xEB\x6F\x3A\x22\xA2\xFF\x13\xA0\xFE\x6E\xFD\x74\xCB\xE9\x9E"
-    "\x75\x09\xC4\x42\xCC\x9B\xA4\xA3\x6C\x60\xB0\x80\x56\xD1\xDB\x0C\xC0"
-    "\xB4\x6E\x2D\x27\x22\x1C\x56\x0F\xD8\xC7\x0B\x00\x8F\xB2\xD4\xFE\x09"
-    "\x23\x24\x1A\xA0\xA0\x8E\xC8\xF1\x39\xF9\x39\xE8\xF3\x55\x22\xA0\x4D"
-    "\x8D\x57\x6F\xB2\x77\x27\xBC\xB7\xEB\x9E\x2E\x3B\xDD\x87\x0E\x00\x41"
-    "\x4E\x4D\x46\x12\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F"
-    "\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xFA\x00\x00\x00\x2F\x3F\xC0"
-    "\x07\x00\x0F\xE1\x38\x00\x00\x22\xCA\xB6\xEB\xDB\xAF\x11\xEC\xF9\x9A"
-    "\xD0\xC6\x17\xE7\x9B\x83\x6D\x64\xDB\x4A\xBE\xFF\x8F\xBB\x4B\xEA\x85"
-    "\x50\x37\x3D\x68\x48\x4A\xEE\x32\xC3\x26\x00\xC0\x24\x73\x57\xE4\xB5"
-    "\x9F\x8B\x8B\x18\xF4\x23\x13\x09\x08\x40\x01\xF7\xF9\x0F\x00\x80\x82"
-    "\x19\x30\xAA\x01\x63\x4C\xF5\x72\x8C\x6A\x1C\x52\xAD\x28\xBC\xA8\x9D"
-    "\xBD\xF3\x89\xCD\x46\x73\x74\xC3\xD3\x43\x05\x85\xBF\xA0\x5E\x5F\x2A"
-    "\xA7\x37\x74\x6B\xC1\x14\x81\x87\x06\x42\x08\x6A\xEF\xC1\x84\x18\x4C"
-    "\x8D\xEE\x1F\xE7\x72\x68\x1E\xC8\x16\x1D\xC7\xFF\x95\xFF\x62\xEA\x0A"
-    "\xEE\x3A\x78\x9C\x3B\x6B\x3F\x29\x5C\x49\x92\x6C\x5A\xE7\xDA\xD6\x33"
-    "\xF6\xBF\xCE\x99\x83\xEB\xBF\xDB\x71\x22\xFA\x3F\x01\xE2\xE4\x8C\x66"
-    "\xF7\x9B\xDD\xBE\xBE\x01\xB9\x25\x6A\x25\x69\x7B\xA9\xF0\x38\xC0\x5B"
-    "\xD0\x6A\x7A\x81\x46\x81\x24\xA7\x24\x3E\xAC\x0E\x48\xCC\xAB\x04\xFE"
-    "\x54\x0C\xFD\x19\xA3\x20\x9E\xC0\x40\x99\xC8\x79\x70\xC6\x79\xD0\x1A"
-    "\x42\x53\xEE\xD6\x42\xF1\x4B\x8D\xD1\xEE\x1C\x7C\x87\x35\xCB\xEF\x35"
-    "\xB7\x75\x0D\x66\x37\xCD\xEE\x48\x05\x41\x4E\x4D\x46\x1C\x01\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\x03\x01\x00\x00\x2F\x3F\xC0\x07\x00\x27\xC1\xA6\xB6\xF6"
-    "\x26\xE9\xBD\x0A\xC8\x89\x81\x04\xF0\xC0\x8C\x71\x56\x04\xB0\x71\x18"
-    "\xFB\xD4\x74\xB0\x8D\x6C\x5B\xC9\xFB\xEE\x1F\x8B\x9C\x90\x1A\x28\x83"
-    "\x6E\x29\x06\x2A\xD0\xCC\x65\xD8\x46\xB6\xAD\xE4\x7D\xF7\x8F\x43\x4C"
-    "\xA8\x99\x66\x74\x48\x5B\x94\x41\x4E\x01\x4E\x30\xFF\x01\x00\x86\x30"
-    "\x64\xAC\x85\x09\x21\x95\xE2\xDA\x5D\x3A\x23\xDF\x31\x93\xD7\x07\xC5"
-    "\xA1\xF5\xA4\xE2\x00\x4A\x57\x42\x18\x73\xDE\x1B\xD9\xA4\x9B\x2A\xFD"
-    "\x7E\x22\x47\xE1\xFF\x37\xA6\x91\x60\x7D\x88\x41\x60\x82\x8F\x81\xC5"
-    "\x92\x7E\x78\x71\x9B\x89\xF3\x72\xF0\x40\xEC\x5E\xC1\x90\xFC\xC4\xD6"
-    "\xDB\x96\x17\x1F\x3B\x21\x50\x72\xBF\x82\x2B\x49\x92\x4D\xAB\xAF\x6D"
-    "\x5B\x6F\xFF\xBB\x9C\x39\x7A\xFA\x8C\xE8\xFF\x04\xE0\xBF\x9D\x1B\x97"
-    "\x1A\xF7\x5F\x6D\xDB\x76\x9E\x89\x43\xCA\x78\x9E\x52\x2C\x06\x50\x82"
-    "\xA6\x3C\xD6\x03\x9C\x32\xF8\x9C\x95\xD8\x81\x90\x75\xE9\xB7\x01\x1D"
-    "\x75\xC3\x87\xEA\x89\xB1\x10\x35\xD0\x53\x31\xD4\x73\x2A\x29\x3A\x72"
-    "\x12\x75\x85\x2A\xBA\xE9\x7B\x48\x7E\xC9\xD1\xDA\x31\xEE\x23\x67\xAE"
-    "\x69\x91\x6D\x9A\xDE\x81\x71\x83\x71\x3F\x35\x00\x41\x4E\x4D\x46\x12"
-    "\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00"
-    "\x00\x00\x56\x50\x38\x4C\xF9\x00\x00\x00\x2F\x3F\xC0\x07\x00\x27\xC1"
-    "\x26\x00\xC0\x24\x73\x45\x5F\xD7\x14\xDC\x90\x93\x44\x64\x70\xBF\xB9"
-    "\x34\x07\xDB\xC8\xB6\x95\x7C\x77\x0D\xFF\x87\x9C\x1A\x48\xE9\x3F\xD5"
-    "\x12\x20\x74\x9F\x61\x1C\xC9\xB6\xA9\x67\xBF\xAF\xAD\xB5\xB4\x7F\x18"
-    "\x3F\xFF\x48\xFC\x6B\xFE\x03\x00\x10\x63\xC6\x8D\x8E\xA0\x8C\xB8\xD1"
-    "\x77\x8A\x4C\x5D\xB9\x9C\xE0\x71\x82\xC7\x30\x06\x21\x84\xB7\x5F\xD2"
-    "\x7F\x72\x8D\xA7\xEE\x81\x72\xB1\x53\xF1\x56\x00\xA1\x6D\x80\x35\x3D"
-    "\x78\x79\x1A\xB0\x75\x33\xE0\x01\x81\xFF\x83\x2A\xFA\xA0\xF3\x08\x53"
-    "\x04\xB7\x35\x42\x08\xB5\x1F\x30\x21\x9A\xE9\xF7\xF7\x8D\xBD\xC6\x3E"
-    "\x1F\x2A\x97\x8A\xC2\x95\x24\xC9\xA6\x75\xAE\x6D\xF3\x71\xFF\xAB\x7C"
-    "\xC7\x4F\xBF\x1D\x13\xD1\xFF\x09\x60\x7F\xCD\xD0\xBA\xD4\xBA\x3F\x7B"
-    "\x4E\xD4\xE3\xD5\xA2\xA4\xDD\x48\x17\x70\x03\x97\xF7\x10\x3A\x18\xC8"
-    "\x9C\x91\x33\x33\x64\x42\xAB\x79\x13\x70\xF2\x76\x3C\xA1\xBD\xE3\x0D"
-    "\x9C\x8A\xE1\xC2\xBB\x42\xD8\xD1\x55\x2B\x91\x0C\x74\x95\xFA\xEE\xBA"
-    "\xF8\xC5\x85\xA0\xB8\x51\xF4\xE7\xF4\x5D\xDB\x12\xCF\x36\xB3\x63\xEB"
-    "\x22\xEB\xBE\x6B\x00\x41\x4E\x4D\x46\x16\x01\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xFE"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\x27\xC1\x26\x00\xC0\x24\x73\x1F\x50"
-    "\xC1\x2E\xFA\x17\xE0\x72\x32\x70\xC2\xE7\xAE\x35\xD8\x46\xB6\xAD\xE4"
-    "\xBB\xE3\x21\x29\x31\x45\x50\x1D\x2D\xBE\x0C\xCB\xDD\xD5\x8D\x24\xDB"
-    "\x4A\x75\x71\x77\x4B\x29\x22\x32\x77\xD8\xFF\x4E\xDC\xE5\xBB\x54\xCD"
-    "\x7F\x00\x04\xB9\xE1\x49\x81\x4B\xFA\xBF\x6E\x6B\x9C\x1D\x6D\x19\x67"
-    "\xB1\x18\x79\xA1\xCC\x56\x8D\x7E\x3C\xFC\xB5\x69\x81\x97\xCF\x3A\xC8"
-    "\x6E\xB1\xC9\x8F\xFF\x91\xEA\x02\xBC\x69\xCD\x4B\x48\x1C\x7C\x79\x93"
-    "\x4B\x49\x8C\x24\x36\x2F\xD7\xE9\x18\x50\xB4\x62\x17\x18\xCA\x43\x0E"
-    "\x2E\x36\x44\xDA\xFD\x6E\x59\x6E\x9E\xE7\x27\xFA\x3D\x7D\x06\x1A\x0F"
-    "\x01\x47\x6E\x24\x29\x52\x0E\x33\xF6\xF0\x2C\xEF\xFE\xFF\x95\x5B\xD5"
-    "\x30\x7C\x8B\xE8\xFF\x04\xE0\xC8\x3E\x17\x17\x2C\xEE\x62\x4D\x92\xC4"
-    "\x75\xFF\x39\xC4\x8F\x55\x09\xA1\x0B\xB8\x81\xA4\x06\xE0\x41\x35\x80"
-    "\x30\x67\x22\x46\x20\x5E\x5C\xC4\xB8\xD7\xD0\xEE\x51\x33\x91\xB3\x7C"
-    "\xB0\x2D\x5D\x85\x92\x2F\xAF\xD3\x95\x29\x91\xEC\x75\x7D\x88\x34\x8A"
-    "\xA0\xB8\x54\x74\x72\xBF\xEC\xA5\xB5\xAF\xA5\x99\x1D\x2E\xEE\xBD\xB8"
-    "\x8D\x05\x41\x4E\x4D\x46\x2E\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x15\x01\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\x47\xE1\x38\x00\x00\x22\xCA\x76\xBD\xEC\x1A\xA1"
-    "\x21\x5B\xA0\x19\x1A\xA1\x51\x6C\x3C\x71\xE6\x1C\x4C\x6C\xDB\x56\xF2"
-    "\xDD\x3F\x0E\x95\x4A\xA7\x31\x67\xE6\xC0\x08\x88\x56\xBD\x92\x5C\x16"
-    "\xDB\xC8\xB6\x95\x7C\x77\xA5\x02\x32\x7E\x09\x64\xF4\x9F\xD0\x85\x67"
-    "\xEE\x30\xF3\x1F\x00\x00\x21\x84\xD0\x5A\xC3\x39\x47\x08\x01\xC6\x98"
-    "\xE8\x47\x82\x17\x80\x10\x4A\x4B\xE0\xF7\xFC\x3E\x49\x6D\xDB\x1B\x8F"
-    "\x81\x80\x10\xA1\xAE\xD4\x7E\x77\x94\x64\x64\x6C\x9B\xDF\xFB\x3A\x1A"
-    "\xED\xDA\x9F\xDA\x1B\xF2\x44\x89\xF2\x6F\x30\x42\x9C\x9F\x49\xD0\x64"
-    "\xCA\x01\x54\x7B\x51\x01\xBC\x19\xF0\x01\x99\xFF\x0B\xE9\x55\x2E\xB6"
-    "\x95\xA2\x4E\x06\x8E\xED\xB6\x90\xA7\x54\x96\x25\x06\x57\x92\x6C\x2B"
-    "\x0D\x2E\x71\x88\xBB\xCB\xFE\xD7\x98\x7B\xB9\x12\xFD\x3B\x44\xF4\x7F"
-    "\x02\x82\x6F\xF6\xE1\x2E\x75\xF7\x67\x9D\x00\xBD\xF6\x59\x97\xB8\x73"
-    "\x86\x25\x44\xAA\xA4\x65\x00\x6B\x90\xD4\x31\xC0\x85\x38\x03\xA5\x44"
-    "\x14\x26\x32\x7B\xE2\x00\x8C\x95\x9A\xCA\xD4\xD4\xA9\x13\xE8\x0F\xA8"
-    "\x1D\x31\xE7\xF4\xC1\x1E\xA9\x2D\x25\x6E\xBC\x8D\xDA\x42\xA2\xE1\x56"
-    "\x6D\x46\x4C\x6B\x04\xB2\x2B\xA9\xFF\x66\x11\x7B\xBB\x66\xA6\x72\x09"
-    "\xE3\x95\xBB\x37\x0B\x00\x41\x4E\x4D\x46\x24\x01\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C"
-    "\x0C\x01\x00\x00\x2F\x3F\xC0\x07\x00\x3F\xC1\x26\x00\xC0\x24\xF3\x0D"
-    "\x87\x00\x2E\x37\x1D\xA0\x08\xED\x08\xC4\xEB\x2E\x17\xB7\xD7\x60\x1B"
-    "\x00\x60\x99\xD8\x28\x37\xDD\xC0\x6F\xFA\x48\x0F\xEE\xA8\xC9\x62\x13"
-    "\x00\x60\x92\xB9\x0F\x97\x06\x24\xD0\x38\x14\xA4\x05\x2F\x1F\x29\x38"
-    "\xDD\x61\xFE\x03\x00\xF0\xFF\x7F\x92\x94\x20\x84\x38\xE7\x0C\xEF\xA2"
-    "\x94\x4A\xBA\xC5\xBB\xD7\xA4\xF3\x76\xA8\x48\x9C\x4A\xAA\x31\x54\x63"
-    "\x98\x81\xE7\x5A\x1B\xD9\xB6\x21\x7B\x4A\x8B\x1F\xFE\xC7\x54\x49\x0F"
-    "\x96\x23\xCB\xBB\x4A\x70\x5B\x54\x46\xF5\x11\x9E\x1D\x7A\x6C\x5D\x0C"
-    "\xB8\x41\x20\x85\x0F\xB1\xE4\xCE\xE9\x82\xC7\x4E\xF1\x01\xDF\x77\xEB"
-    "\xAB\x89\x3D\x0C\x72\x4A\x58\x7D\x0B\xAE\x24\x49\x52\x95\x7E\x0F\x7B"
-    "\xEE\xAE\x38\xF7\xBF\x23\xBD\x8A\xFE\x45\xF4\x7F\x02\xF0\xC1\xC6\xD6"
-    "\x25\xD6\xFD\xD9\xAB\xAA\x1A\x86\x67\x0B\xB9\xC2\x17\x38\xAD\xAB\x8A"
-    "\x38\x69\x05\x80\x14\x94\xCD\x40\xCD\x1E\xC0\xCA\xB6\xCC\xDD\x78\x6A"
-    "\x26\x91\x46\x8D\xC3\x64\x75\x1D\x57\x68\xEF\xD9\x48\x72\xA1\x1E\x38"
-    "\xB0\x9B\xB6\x42\x49\x07\xD1\x8B\x15\x81\xD0\x59\x5B\x46\xEE\x4D\x03"
-    "\xB5\xA5\xAA\x3F\x77\xB4\xB7\x2D\xDC\x99\xD4\x2A\x31\xDB\xB3\xCE\x74"
-    "\x41\x4E\x4D\x46\x26\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x0E\x01\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\x4F\xC1\x26\x00\xC0\x24\x73\xBD\x04\x77\x5E\x7B\x89\xBF"
-    "\x16\x34\x71\xAF\xC1\x34\x00\xC0\x24\x73\x23\x79\xF3\xE6\x9C\xC0\xF1"
-    "\x44\x2E\x58\x45\x2F\x70\x65\x13\x00\x60\x92\xF9\x70\xD7\x0F\x1A\xD8"
-    "\x05\x55\x08\x41\x58\x6E\x2A\xB8\xFB\xFC\x07\x00\xE0\xFF\xFF\x84\x10"
-    "\x50\x4A\x11\x42\x44\x9E\xC7\x5A\x96\xFB\x88\xD9\x84\xD3\xDF\xA0\x89"
-    "\x22\x86\xD6\xA4\x61\x42\x69\x23\xD8\x5B\xD9\x7A\x3A\xFC\x10\x21\x84"
-    "\x52\x92\xEE\x81\x30\x21\xF6\x72\x36\x8B\xD2\xDE\x13\x08\x11\xD9\x42"
-    "\xD1\x46\xE3\x7F\x82\x82\x0E\xBB\x00\x8F\x6F\x79\x4B\x4D\x4F\x6E\xAC"
-    "\x55\x98\x22\x5C\x27\xEE\xAE\xB2\xE8\x03\x42\x05\x65\x5E\x30\x42\xDA"
-    "\x8F\x81\x23\xC9\xB6\xD5\xE4\xC6\x05\x87\x18\x0E\xF1\xEC\x7F\x8B\xDC"
-    "\xC7\xB7\x51\x46\x11\xFD\x9F\x00\x38\x3C\xB4\xCE\xB3\x6E\xBD\x98\xAB"
-    "\xE9\xFB\xBE\xAA\x7E\xDD\xC8\x0B\x07\x76\x6D\x5B\xC9\x9E\xA4\xF9\x51"
-    "\x02\x6C\x41\xD9\x1D\xB8\x90\x0E\x68\x05\x42\xBF\x54\xF4\x90\x14\x9A"
-    "\xFE\xD5\xF4\x6D\xC1\x13\x24\x8A\x1A\xF6\x24\xA3\xA4\x01\x3E\x0C\x1B"
-    "\xE8\x9A\x55\xD4\x10\xBF\x6D\xD8\x99\x35\x91\xA1\x28\xA0\x76\x51\xB5"
-    "\x6E\x3C\xC5\x46\x65\x2A\xA2\xC0\xA8\xB3\x0A\xA7\x03\x41\x4E\x4D\x46"
-    "\x34\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A"
-    "\x00\x00\x00\x56\x50\x38\x4C\x1B\x01\x00\x00\x2F\x3F\xC0\x07\x00\x37"
-    "\xC1\x46\x00\x00\x15\xA7\x3B\x66\xA6\xDE\xBC\xD4\x8F\x9A\xD5\x17\xEC"
-    "\xDD\xDD\x7C\x83\x6D\x64\xDB\x4A\xDE\x7F\x5F\x63\x03\xBA\x80\xAE\x28"
-    "\x93\x3A\x08\xDD\xDD\x22\x3E\xC3\x36\xB2\x6D\x25\x5F\x81\xD4\x25\xA2"
-    "\x05\x8B\xAC\x14\x7A\xA3\x16\x2A\xA0\x02\x77\x97\xCC\x67\xE6\x3F\x00"
-    "\x80\xA4\xE2\x40\x04\x22\x24\x2B\xDE\x7E\xC5\xDB\x3A\x6B\xCE\x72\x2C"
-    "\xCC\x57\xB7\x40\xCC\x02\xAA\x3F\x4E\x7F\xA1\x58\xF2\x0B\x8C\x2E\xCE"
-    "\x7C\x94\x9F\x61\xE3\xE9\xF7\x2F\x2C\x4E\xC9\xBE\x94\x77\xBD\x61\x3F"
-    "\xB4\x55\x20\x7B\x43\xF8\xEE\x48\xA7\xD1\xF3\x7D\xA6\xC4\x14\xA4\xBC"
-    "\x42\xBF\x20\x4C\x88\x86\x41\x9C\x11\x27\x32\x5C\x02\xB8\x41\x90\x90"
-    "\x95\x94\x41\x0A\x57\x92\x6C\x2B\xCD\x83\x38\x71\x81\xB8\xCB\xFE\x17"
-    "\xC9\xB9\x4F\xA3\x5F\x39\xEF\x45\xF4\x7F\x02\x54\xB8\x2B\xEF\x4A\xEF"
-    "\xBE\x97\xC9\xBB\xE8\x9D\xE9\x41\x4A\x2D\xD6\x34\xC1\x7D\xDD\x17\x74"
-    "\x4F\xC9\xC4\x9C\x2C\x2B\x44\x4E\x59\x8F\x6E\x64\x81\xF6\x8A\x27\x03"
-    "\xE4\x21\xCF\x4C\x5C\x5D\xEA\x51\x6C\xE9\x94\x14\x5C\xF2\x2F\xD0\x6C"
-    "\x83\x0B\x18\x89\x22\x79\x04\x9C\xD1\xD6\xD8\xD4\x0A\x3D\xBC\xE8\x50"
-    "\xEA\xCE\xB0\xA0\xC2\x3B\xD1\xC4\xD8\x6F\xE3\xA6\xE1\xDB\x22\xBA\x74"
-    "\x36\xE2\xF6\xD6\x35\x00\x41\x4E\x4D\x46\x42\x01\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C"
-    "\x29\x01\x00\x00\x2F\x3F\xC0\x07\x00\x5F\xC1\x46\x00\x00\x23\xA7\xEC"
-    "\xDA\xF5\x85\x9E\xD0\xF3\x35\x69\xF7\x66\xBB\x6F\xB0\x8D\x6C\x5B\xC9"
-    "\x77\xC5\x89\xC8\xDC\xCA\x80\xEE\x09\x09\xC9\x28\xC1\x5D\x86\x71\x00"
-    "\x00\x2A\x74\xF7\x16\xDE\x5E\xE6\x35\x81\x21\x3A\xDE\x06\xE8\xEE\x76"
-    "\x98\xFF\x00\x00\x8A\x31\x4A\xD0\x2C\x9A\x11\x04\xCD\xD2\x5C\x19\x06"
-    "\x2A\xD9\x2D\x29\xB6\x68\x45\x12\xC3\x0A\xB8\xA1\x65\x3F\x3A\xBF\x34"
-    "\xA8\x8E\x44\x34\x38\xE6\xF5\x72\x3E\xCD\xD2\x9F\x10\xD2\x49\x3E\xE0"
-    "\xFC\x84\xA8\x81\x34\xC1\xE3\xFB\x81\x63\x3B\x68\x15\x2E\xC7\xBC\x8B"
-    "\x41\x6E\xA0\xF0\x20\x60\x4D\x89\x61\x1C\x49\x43\xE6\x7D\x81\x8C\xFC"
-    "\x6C\x6E\xDA\xB3\x0B\x42\xB1\xF7\xF9\xC4\xDD\xC2\x27\x91\xA6\xFE\xB5"
-    "\xAD\xCF\xE0\x4A\x92\x24\x55\x99\xF7\x70\x77\x1E\xEE\xCE\xFD\x6F\xF8"
-    "\x7A\x58\xC1\xBF\x7A\x22\xFA\x3F\x01\xF2\xBC\xD7\xD1\x15\xA3\xFB\x5E"
-    "\x16\xA3\xB3\xE8\xDE\xD4\x9E\xD9\xCC\xF2\x56\xE0\xD6\xDD\xA1\xF1\x89"
-    "\x2E\xA6\x35\x21\x37\xA5\x3C\xB2\x41\x88\x96\xC2\x2D\x38\x90\x27\x07"
-    "\xE4\x51\x98\x26\x0E\x16\xBE\xCA\x34\x54\x17\xB5\xA7\x13\x05\x37\x69"
-    "\x68\xAF\xCB\xD0\x1C\x0C\x34\x99\xF0\x8C\xD8\x20\xAE\x3A\x1A\x3A\xBA"
-    "\x28\xAE\x8A\x07\xFD\x4C\x44\x1D\x4E\x7F\x4B\x81\x77\xDD\xC8\xD5\x7F"
-    "\x6B\xA7\x14\x54\xCB\x45\xA5\x10\x54\xDB\x85\x5F\x00\x41\x4E\x4D\x46"
-    "\x36\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A"
-    "\x00\x00\x00\x56\x50\x38\x4C\x1D\x01\x00\x00\x2F\x3F\xC0\x07\x00\x3F"
-    "\xC1\x26\x00\xC0\x24\x13\xDC\xE1\xF6\x97\x12\xD6\x82\x4C\x74\xE3\xA2"
-    "\x80\x73\xB9\x3B\x35\x98\x06\x00\x98\x64\xEE\xB8\xCB\x17\xFC\xCC\x3F"
-    "\x44\x1A\x69\x09\xB7\x64\x6C\x23\xDB\x56\xF2\xA2\x6F\xB8\x3B\xB4\xE0"
-    "\xD6\x15\xC5\x51\x04\x29\x19\x0D\x40\x68\x99\xC3\xFC\x07\x00\x90\x53"
-    "\x0C\xA7\x18\xBD\xF6\xA9\x81\x42\xF6\x24\x58\xF6\xA8\x76\x76\xCE\x0B"
-    "\xA7\xD3\x44\x08\x34\xF9\xED\x87\x80\xAE\x0F\x19\x16\x5C\x0C\xDC\x40"
-    "\x15\xC2\x07\xB3\xE4\x86\xE9\xD2\x8E\x11\x17\x58\x88\xE6\xF7\xD8\x96"
-    "\x38\x4C\xFA\x6D\x97\xFE\x17\xC5\x97\x25\x23\xA1\x9D\xA3\xE7\x79\x78"
-    "\x77\x6C\xE9\x0F\x08\x35\xC4\xE8\xE1\x7C\x48\x8C\x76\xFF\x7B\x2B\xED"
-    "\x00\x3B\x1D\xB8\x92\x24\x49\x55\x1A\x1E\xEE\x3C\x77\x97\xFB\x9F\x11"
-    "\x7A\x58\xC1\xBF\x22\xFA\x3F\x01\x50\xBF\x84\xED\x99\x75\x5F\xCB\xC9"
-    "\xBA\xC2\xBA\x4F\xB5\xAA\xAA\xE3\xF1\xDE\x95\xAC\x93\x98\xED\x5C\x57"
-    "\xC5\x3E\xBF\x49\xEF\x01\x3D\x28\xBB\x00\x31\x09\x00\x57\x01\x10\x02"
-    "\x98\x29\x38\x6B\x1A\x31\x0A\x7C\x88\x35\xB9\x2E\xE8\x80\x41\xF0\xE0"
-    "\x81\x9D\x48\x23\x39\x00\x2E\x41\x0F\x6D\xAD\x22\x8F\x6D\x25\x85\x51"
-    "\x2B\x25\x93\xA6\x3A\x8E\x41\x37\x90\x76\x92\x3F\xDA\xC5\xDC\x28\x47"
-    "\x45\xE9\x18\x15\xA9\xD0\x0B\x00\x41\x4E\x4D\x46\x42\x01\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50"
-    "\x38\x4C\x29\x01\x00\x00\x2F\x3F\xC0\x07\x00\x5F\xC1\x38\x00\x00\x15"
-    "\xD7\xAD\x9B\xAF\x2F\x2F\x73\x18\xD4\x10\xBC\xCD\x61\x84\x6E\x6B\xB0"
-    "\x8D\x6C\x5B\xC9\x37\xDC\x9D\x0E\x08\x19\x72\xEB\xDD\x29\x84\xD4\xDD"
-    "\x61\x13\x00\x60\x92\xB9\xFB\xD0\x08\x7A\x91\x81\xFE\xB4\xE0\xD2\xDF"
-    "\xE6\x3F\x00\x00\x8D\x68\x20\x84\xA4\x6E\xC3\xD7\x13\xC1\x0A\xF3\xD0"
-    "\xF2\x02\x24\xFC\x57\xA9\xBA\x70\xD5\xC0\x55\x03\x57\x0D\x62\xBB\xD2"
-    "\xD0\x1A\x26\xC4\xA4\x6A\xAE\x1A\xB8\x6A\x30\x52\xC8\xD9\x08\x18\x52"
-    "\xF3\x74\x28\x97\x84\x26\x4E\xFF\x13\x14\x1C\xD8\x05\x0C\xCC\xEF\x7F"
-    "\x1E\x45\x46\x25\xE9\x6D\xDF\x77\xED\xB2\x31\x9E\x80\xBB\xC9\xDC\x12"
-    "\xB5\x86\x74\xE1\xAC\xF2\x2D\x4C\x21\xDF\xD7\xF1\x0D\x69\xAF\x3F\x06"
-    "\x57\xB6\x6D\xA7\xC9\xC3\x9D\x2A\x2E\xC1\xA9\xCC\x7F\x84\xCD\x7B\x49"
-    "\x8A\xF3\x75\x13\xD1\xFF\x09\x20\xEB\x63\x3C\xFA\xE0\xE1\x3E\xD7\xD1"
-    "\xC3\x0D\x1F\xEE\x5B\x79\x02\x12\x68\x96\xCC\x76\x1A\x08\x16\x99\xB7"
-    "\x30\x9B\xF7\x2A\x91\x0E\x50\xD0\x73\x2B\x20\xE0\x4A\x42\xA6\xEB\x02"
-    "\xF0\x1A\xA0\xA8\x34\xCD\xD6\x8E\x70\x80\x07\x9B\x57\x84\x8E\x32\x4F"
-    "\xAC\x82\xE7\xFA\x06\x29\xB3\x61\x2E\xA2\x94\x90\x31\x50\xB0\xCD\x9D"
-    "\x6D\xDD\xB9\xFD\xA3\xDC\xEA\x77\x0C\x40\xFC\x8E\xA4\x57\x41\xC7\xE0"
-    "\x11\xC3\x87\xFB\xA7\x9C\xB4\xEB\x14\x5B\x69\x35\x5C\x00\x00\x41\x4E"
-    "\x4D\x46\x3C\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x23\x01\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\x47\xC1\x26\x00\xC0\x24\xF3\xCF\xAE\x61\x17\x9C\x44\x80\x88\x74"
-    "\x23\x85\xBB\xBB\xD5\x60\x1C\x49\xB6\x92\xEF\xB8\x07\x41\x00\xE4\x5F"
-    "\x45\x0C\xDC\xB8\xB9\xBB\x3B\xB0\x8D\x6C\x5B\xC9\xFB\xFE\x21\x72\x68"
-    "\x81\x16\xE8\x5A\x23\x32\x1A\xB0\x0A\x88\x7E\x8A\xBB\xCE\x7F\x00\x00"
-    "\x31\x26\xE2\x47\x57\x6C\xCA\x15\x4B\x3F\x04\x18\x32\x46\x06\x88\xDE"
-    "\x50\xBA\x81\x07\x4A\xE7\x09\x8B\x7F\x40\x28\xC4\xAD\x87\xFB\x71\x11"
-    "\x1A\xFD\xEF\x2D\xC9\x1A\x58\xC9\x10\x42\x2D\xCB\xA2\x1E\x23\x6D\x1E"
-    "\x18\x86\xC1\xB2\x2C\xEE\xFB\x16\x04\xAD\xF0\x47\xD8\x05\x56\x66\x49"
-    "\xDC\x8E\x23\x16\xBC\x62\x30\x0C\x03\x6D\xE7\x7C\xE0\x23\xCE\x8F\x52"
-    "\x62\xE8\x4B\x43\x7B\x81\x2B\x49\xB2\xD3\x66\x1D\x8E\x99\x31\x4C\xCA"
-    "\xFD\xAF\x28\xAD\xCC\xF4\x17\xD1\xFF\x09\x40\xE3\x67\xF4\x3D\xEF\xDD"
-    "\x74\x8D\x7A\xF7\xEA\xDD\x52\x6D\x59\xD6\x76\xAB\xD8\x90\xCA\x34\xD9"
-    "\x51\x88\x26\x0E\xBB\x87\x94\xAB\x00\x1F\x6A\x76\x03\x4C\xF2\x01\x04"
-    "\x09\x01\x84\x0A\xE0\x27\x19\xF5\x2E\x2D\x21\x40\x00\xFA\x95\x34\xDB"
-    "\x11\x02\xDC\x87\xCF\xDE\x35\xF6\xE4\x4A\x1C\x9D\x3D\x20\x18\x7C\x34"
-    "\xCD\xDC\xD6\xEE\x3D\xF9\xF7\xC0\x36\x4D\xD0\x0A\x29\x34\xBD\xC6\xC6"
-    "\x38\xEB\xDD\xA9\x77\x2B\x6A\x5C\x74\xEA\xD9\x44\x52\xB6\x02\x00\x41"
-    "\x4E\x4D\x46\x34\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F"
-    "\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\x1C\x01\x00\x00\x2F\x3F\xC0"
-    "\x07\x00\x2F\xC1\x34\x00\xC0\x24\x53\x9C\xA4\x49\x2B\xC9\xA2\xBF\xCD"
-    "\x01\x7C\xA2\xC9\xDD\xFE\x60\x62\xDB\xB6\x92\xEF\x49\x70\x66\x40\x67"
-    "\xFE\x89\x45\x24\xD2\x7E\xC2\x49\xEE\x0E\x6E\x22\x00\x40\x22\xDC\x27"
-    "\xB7\x89\x06\x6E\x23\xF4\x22\x05\x71\xC8\xA0\x13\x14\x60\x74\xB7\xFF"
-    "\x9B\xFF\x00\x00\x28\x71\x46\x35\x83\xFA\xAD\x33\x1E\x0B\xA1\x11\x61"
-    "\x88\x32\x6A\x00\xD1\x6B\xE6\xB0\x1B\x62\xDC\xA6\x2E\x08\x85\x64\xEB"
-    "\xE3\x7E\x98\x22\xD7\x50\x18\xF9\x92\xCE\x75\x5C\xDE\x43\xB7\x6E\xB9"
-    "\x48\xB5\xE2\x1F\xC4\x5C\x80\x9D\xB1\xEA\x60\x60\x84\xB3\x73\xEF\x8D"
-    "\x67\xCA\xF7\x0D\xBA\x2B\xF2\x8C\xCC\xE9\xDD\x10\x6A\xFC\xF7\x9F\xE2"
-    "\x3A\xD8\x31\x51\x46\x31\x85\x2B\xDB\xB6\xD3\x04\x77\x87\xE2\x56\x9B"
-    "\xFF\x24\xF3\xA2\xE8\x5F\x4E\x1A\xD1\xFF\x09\x68\x59\xAF\xF8\x52\xD7"
-    "\xC1\x8D\x82\xFB\x57\x4E\xA0\xDB\xA8\x3A\x42\x36\x8E\xD2\x30\x8F\xC2"
-    "\x16\x88\xAA\x41\xEA\xAD\x34\xE0\x8C\x28\x1D\x5B\x8C\x85\x07\xE4\xAA"
-    "\x0B\xD0\xA8\xA0\xC4\xCE\xDE\x0D\x89\x44\x08\x79\xC4\xCA\x53\xAF\x2F"
-    "\x1D\x84\x99\x4E\xBF\x45\x2E\x90\xD0\x5C\x5A\x9A\xBB\x3A\xE9\x18\x3A"
-    "\x2B\x02\x98\xC6\x88\x98\x51\x23\x2F\xAC\x7D\xE5\xB7\xE0\xAE\xC1\xFD"
-    "\x50\x77\x6D\xAF\xA2\x8D\xFB\xC6\x09\x41\x4E\x4D\x46\x32\x01\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\x19\x01\x00\x00\x2F\x3F\xC0\x07\x00\x2F\xC1\x26\x00\xC0"
-    "\x24\x73\xDC\x5E\x8D\xC0\x49\x00\xA2\xD0\x96\x12\x5C\xEE\xEE\x56\x83"
-    "\x69\x6D\x6D\x6D\xE8\xC5\x81\x43\x71\x70\x0C\xC0\x06\x0C\xCB\x0E\x2C"
-    "\xD4\x21\x89\x8A\x6A\x4C\x03\x00\x4C\x32\x37\x9C\x03\xF8\x80\x66\x91"
-    "\x87\x77\x01\xD5\x2B\x4F\xB8\x66\x9F\xFF\x00\x00\xA4\x94\xAA\xE7\x22"
-    "\xA2\xC8\xC9\x81\xE2\xB1\x5C\x0C\xB8\x81\x2F\x80\x0F\xFE\x8C\x0C\xFB"
-    "\xD2\xFC\xA5\xF7\xBF\x99\x95\xDA\x50\xE1\xFB\x3E\xC3\x75\x8A\x8D\x2B"
-    "\xBD\x33\x86\x4C\xB1\x9C\xFB\xDF\x5B\x52\x3A\xA1\x10\x64\x2F\xE0\x23"
-    "\x34\x6F\xC2\xD3\x48\x17\x6B\x33\xD7\x48\xF8\x51\x8A\xF9\x4E\x73\x6D"
-    "\x00\x63\x4C\x57\x2E\x2C\x5B\x2C\xF5\x0C\x8E\xDC\x48\x52\xA4\x9A\x59"
-    "\x1C\x58\xEE\x65\xA6\xFF\x3F\x72\xBA\x1A\x96\xF7\x16\x1D\xD1\xFF\x09"
-    "\x90\xE0\x63\xBE\xD4\xFC\xE9\x4E\x4F\xF7\xAF\x5C\x41\x2B\xD9\xFA\xCA"
-    "\x7D\x87\x36\x28\x50\x16\x40\xB2\x54\xA9\x3D\x69\x5C\x2D\x60\x44\xD5"
-    "\x7A\xB0\x53\xF6\x42\x61\x9B\x03\xC9\x02\x47\x9A\x99\x5F\x37\x0E\x46"
-    "\x8C\x78\xE8\x91\x0A\x24\xC4\xC1\xA3\xD6\x3A\xCA\xC6\xA5\x86\x42\xC1"
-    "\x88\x3E\x0B\xB5\x8E\x35\x75\xF0\x7D\x41\xCB\x1D\xA2\xDE\x6F\xA5\xE8"
-    "\xDB\x60\xBF\xD8\xEB\xD3\x8D\x9E\xEE\x67\x79\x09\x31\x3C\x47\x01\x00"
-    "\x41\x4E\x4D\x46\x22\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\x0A\x01\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\x1F\xC1\x36\x00\x80\x24\x34\xD8\x6E\x4C\xD6\x1B\xED\xFB"
-    "\xBA\xF9\x83\x63\x77\xEB\x1B\x4C\x03\x00\x4C\x32\x97\xA4\xFF\x3F\xB3"
-    "\xB4\x4C\x23\x39\x24\x77\x07\xB6\x01\x00\x10\xC9\x4D\x36\x8E\xD0\xD6"
-    "\xD8\xAD\x5D\xD2\x01\xBC\xA0\xC9\xB6\x31\xFF\x01\x00\xB0\xFA\x09\x35"
-    "\x28\x90\xED\xD5\x1F\x13\xB5\x11\x61\x88\x92\x35\x80\xE8\x98\x33\xAC"
-    "\xBA\x08\xB7\xC4\x07\x84\x6C\x86\x7B\x04\x1F\x26\xCF\x35\x14\x3A\x9E"
-    "\x24\xD5\x34\x8D\x79\x9E\x85\x69\x22\xFA\x41\xEC\x02\xAC\x8C\xA5\x77"
-    "\xBA\xE8\xFD\x61\x0A\xB1\x8D\x65\x0F\x9F\x62\xF6\x94\xC4\x27\xFD\x68"
-    "\xDF\x5B\xBF\x74\x59\x8A\x02\x21\x08\x8E\xDC\x48\x52\xA4\x98\xE5\x9E"
-    "\x65\xDE\x1D\x86\xFF\xFF\xB2\xB3\x87\xE9\x16\xD1\xFF\x09\xA0\xEE\x9C"
-    "\xB1\x9A\x77\xAE\xEC\xDC\x52\xED\xFB\xFE\x7A\x6D\xF1\xC4\xCB\x18\x87"
-    "\x7D\x10\x88\x0C\xC8\x2C\xBB\xDD\x6A\x73\x73\x80\x14\xBB\xFA\x82\x51"
-    "\x11\x04\xB6\x14\x48\x2D\x10\xE2\xAE\xDE\x0D\x91\x92\xD2\x85\x20\xA0"
-    "\xB9\xAD\xF8\x88\x93\xD3\x16\x02\x41\x8A\xFE\xD5\x74\x6E\x2C\x71\xB8"
-    "\x76\xAE\x6A\xB5\xA3\x31\xE8\x57\xFC\x47\x5F\x6A\x9B\xE3\xEF\x9D\x3B"
-    "\x74\x6E\xAA\x3E\x6B\x29\x1E\x8D\x00\x41\x4E\x4D\x46\x1E\x01\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\x06\x01\x00\x00\x2F\x3F\xC0\x07\x00\x0F\xC1\x26\x00\xC0"
-    "\x24\x73\x37\x2E\x6E\x02\x70\x12\x81\x02\x94\x20\x0C\x79\xB8\x09\x40"
-    "\x0D\x2E\xBD\xDC\x6B\xB0\x8D\x6C\x5B\xC9\xFD\xEE\x4E\x31\xA4\x94\x40"
-    "\xD9\xA4\x64\xC4\xD6\x83\xC3\x36\xB2\x6D\x25\xEF\xBB\xFB\xEF\x85\xA1"
-    "\x6C\x4A\x80\x9C\x12\xC8\x89\x2C\x73\x98\xFF\x00\x80\xFF\xFF\x8B\x4A"
-    "\x62\xBC\x55\xAF\xBB\x0E\xB3\xF7\x7D\xF1\x13\x9C\x9B\x84\x09\x13\x1F"
-    "\x60\x41\x2F\x05\x33\xCF\xC2\xB2\x1C\x10\x6D\xD9\xF6\x48\x3E\xAE\xA2"
-    "\xBB\xFF\xBD\xF5\x43\x15\x99\x46\xDE\x31\xA1\x71\x6D\x20\x06\x36\xA2"
-    "\x58\xB0\x0B\x34\xEA\x97\x4D\x83\xE2\xEF\xC8\x1E\x2B\xC7\x89\x76\x06"
-    "\x5C\x49\x92\x6C\x5A\x75\x9F\x71\x6D\x63\xFF\xDB\x3C\x7D\x2E\x9E\xDF"
-    "\x57\x44\xFF\x27\x80\xA5\x47\x9E\xF5\xEE\xE1\x9C\x87\xFB\x57\xF4\x3C"
-    "\xEF\x7C\x36\x1C\x44\xEB\xBA\xEA\x56\x14\x2A\x01\x12\xC3\xF5\x7A\x3C"
-    "\x75\x16\x10\x63\x56\x15\xB8\xA2\x87\x42\xC4\x40\x6C\x80\x01\x7B\x55"
-    "\xAF\x44\x4C\xCC\x03\x14\x05\x1B\xB8\x88\x46\x04\x36\x17\x28\x14\x31"
-    "\xBA\x5C\x28\x5C\x2D\xB5\xC8\x1E\x6E\xEE\x3C\xDF\x75\x91\x6D\x5E\x60"
-    "\x19\x2D\xF6\x8B\x1D\x1F\xEE\xFE\x70\x6F\xF4\xB4\x5F\x07\x41\x4E\x4D"
-    "\x46\x0E\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2A\x00\x00\x00\x56\x50\x38\x4C\xF6\x00\x00\x00\x2F\x3F\xC0\x07\x00"
-    "\xFF\xC0\x26\x00\xC0\x24\x73\xDF\x70\xED\xDF\xC3\xB9\x29\x61\xA7\xF3"
-    "\x49\x0E\xA6\x01\x00\xA4\xC1\xA9\x76\x04\x8D\xCC\x15\xBC\x6C\x37\x70"
-    "\x00\x89\x24\x5B\x72\x63\x1B\x00\x40\x12\x1A\x46\xA6\x3C\x9D\x89\x03"
-    "\xF8\xA3\xD5\x37\x9C\x72\x6B\xE7\x3F\x00\x00\x7D\x21\x35\xCB\x6B\x02"
-    "\x33\xB2\xBD\xB6\xE3\xA0\xBA\x82\x21\x95\x35\x20\x8C\x97\x6B\x10\xFF"
-    "\x97\x18\x23\x84\xF6\x74\xF1\x48\x3A\x64\x5F\x46\xDF\xFD\x19\x30\x64"
-    "\x35\xB3\xFE\x0D\x05\x0B\x76\x01\x15\xFF\x95\x01\xCA\xF2\x8E\x89\x60"
-    "\x5F\x37\x55\xF5\x9E\xE2\xBC\xCF\x63\xF4\x13\x38\x6E\x24\x49\x91\x72"
-    "\x99\x99\xD9\x7F\x3F\xB7\x7B\xE1\xF8\x5E\x11\xFD\x9F\x00\xCE\x5E\x79"
-    "\xD2\xD3\xC3\x8D\x0F\xF7\xB7\x18\xC7\xB1\x6D\xEF\x98\x42\x97\x24\x92"
-    "\x9F\xE7\xC2\x00\x0C\x7B\x9E\x67\x59\x8E\x02\x06\xF6\xA5\x1A\x12\x21"
-    "\x85\xFC\x04\xC8\xD0\x4B\xCD\x35\x0C\x0C\x3C\x42\x9E\x73\x03\x57\x68"
-    "\x85\x50\xE3\x42\x2E\x30\xA0\xAC\x4E\x0A\xAE\xEA\x35\xE5\xC3\xCD\x17"
-    "\x45\x49\x82\xD8\x15\x39\xF2\xA6\xF9\xFD\x8F\x0F\x37\x3D\xDC\x0B\x5D"
-    "\x8C\x6B\x00\x41\x4E\x4D\x46\x14\x01\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\xFB\x00\x00"
-    "\x00\x2F\x3F\xC0\x07\x00\x17\xC1\x36\xB2\x6D\x25\xDF\x15\x8D\x18\x22"
-    "\x87\x9C\x98\x12\xA9\xD4\xDD\xA5\x0F\xA6\x01\x00\xA4\xC1\x2D\xD9\x2B"
-    "\x64\x38\x9D\x4A\xA6\xD1\x64\x52\x25\xFA\x18\x47\x92\xAD\xE4\xBB\x7B"
-    "\x28\x0A\x24\x4F\x32\x72\x87\x9B\x53\xF3\x1F\x00\x80\x18\x63\x94\x52"
-    "\x42\x08\x4A\x29\x94\x52\xAE\x89\x1C\x1D\xF8\x69\x56\xFE\x10\xBB\x80"
-    "\x9D\x25\x39\x5C\xFD\xEF\x87\x9F\xC0\x3D\x0B\x18\x52\xDE\x0A\xD0\xE8"
-    "\x04\xC7\x62\xDA\x77\x66\xDB\x0C\x85\xDB\xEA\x09\xA1\x89\xE9\x5E\xD1"
-    "\xC7\x54\xE8\x50\x07\xCF\x95\x83\xD0\x3B\x84\x20\xC5\xF6\x70\x4C\x76"
-    "\xE6\x1F\x1C\x49\x92\xAC\x2A\x85\xBB\xF3\xDD\x06\xEE\x7F\x4B\x66\x9E"
-    "\xB2\xFA\xAB\x88\xFE\x4F\x00\xA1\x57\xFC\xE9\x57\x76\x9B\xEC\x66\x8B"
-    "\x65\x59\x5E\xAF\xCA\xD3\xD8\x17\x85\xF5\x10\x31\x3A\xA0\x53\xEE\xF7"
-    "\xF3\xF9\xF2\xB3\x53\xA0\x43\xB7\x4E\x50\x18\x5F\x10\x3F\xF8\xA0\x2E"
-    "\xBC\x0E\x71\xE8\xE8\xF0\xB1\xE3\x88\x90\xC0\xCD\x38\x1A\xB5\xCB\x0D"
-    "\xC4\xA0\xC3\x9E\x42\x35\xB1\x7A\x87\x31\xBB\x21\x56\x55\x14\x98\x7B"
-    "\x11\xEC\xD6\x61\xFE\xF9\xCE\x6E\x9B\x5D\xCA\xEB\x65\x1C\x00\x41\x4E"
-    "\x4D\x46\x08\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xF0\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\xF7\xC0\x24\x00\xC0\x34\x63\x85\x6E\x7A\x01\xD0\xC2\xA1\xE3\x83"
-    "\xAD\xC4\x35\x73\x13\xA6\x01\x00\xA4\xC1\xB3\xFD\xFF\x0C\x89\x66\x8D"
-    "\xE6\x44\xB6\xE4\xC6\x34\xB2\x6D\x27\x3F\xE7\x6C\xBF\xFF\x36\xE0\x68"
-    "\x92\xD6\x18\x2A\xC0\x22\xC1\x65\x66\xFE\x03\x00\x10\x21\xA4\xBD\xDA"
-    "\x0C\x36\x64\xFB\xFC\x4D\xC0\x90\x32\x03\x20\x7C\xB1\xAD\x3B\x07\xA8"
-    "\x25\x70\x57\x3C\x21\x34\x12\xEA\x65\x3F\x66\x2C\x19\x4C\x85\xE6\x41"
-    "\xB3\xB3\x9C\x56\xE5\x87\xD8\x05\xDC\x2C\xE1\xB3\x12\x8A\x49\xCB\x43"
-    "\x8B\xC1\x6B\x7E\xD3\x3E\x31\xFA\x00\xB7\x91\x24\x29\x52\x1D\xE3\x33"
-    "\x2F\xF9\xEF\xE7\xEF\xDC\xD2\x49\x27\x45\xF4\x7F\x02\xC8\xFC\x4E\xE9"
-    "\x53\x71\x87\xD5\x65\x59\xDA\xD6\x53\x0B\xCF\x79\x96\x06\xA5\x04\x07"
-    "\x38\x4F\xDF\x37\x4D\xF3\xF7\xF0\x80\xC3\x2F\x7D\x60\x16\x0C\xA8\x30"
-    "\xD0\x78\xAB\xA0\x57\x1A\x1C\x8E\x10\x39\x8D\x52\x64\xD0\x09\x6F\xE1"
-    "\xB4\xA5\x03\x25\xE0\x90\x7F\xB1\xCE\xA9\xEC\x8E\x7C\x53\xAD\xF3\x8C"
-    "\xF8\x54\x0A\xF9\xB2\xE1\x1A\x72\xC0\xBC\x15\x37\x16\xB7\x9F\x41\x4E"
-    "\x4D\x46\x04\x01\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xEB\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\xE7\xC0\x26\x00\xC0\x24\x73\x45\x2F\x5E\x08\xA0\x37\x11\x29\x45"
-    "\x04\x68\xE0\x2E\x97\x37\x61\x1A\xDB\x56\xA3\x4F\x06\xC9\xD0\x0A\x9A"
-    "\x96\x69\x03\xC9\xE0\x70\x79\xED\xBA\x9C\xD8\x46\xB6\xAD\xE4\xBB\x7B"
-    "\x23\xFF\xE3\xD0\x34\x3D\xD0\x01\x25\x10\x92\x92\x39\x33\xFF\x01\x00"
-    "\xAC\x7E\xAB\x87\x1D\xD9\x3E\xFF\x10\x30\xA2\xBC\x05\xB8\x60\x11\x02"
-    "\x75\x26\xEE\xCA\x27\x84\x27\xA6\x79\x05\x1F\x93\xE3\xC3\xE2\x3C\x57"
-    "\x0D\x7C\xEB\x10\x8A\xA4\xEB\xC3\xD1\xB5\x37\xFC\x8A\x9C\x95\x71\x55"
-    "\x97\x8D\xF4\xB3\xEC\x87\xD8\x05\xDC\x3C\x01\xDB\x46\x92\x14\xF5\x33"
-    "\x33\x43\xFE\x91\xDE\xDC\x3D\x59\x6F\x45\xF4\x7F\x02\x78\xF8\xCC\xDB"
-    "\x97\xD7\xFD\x56\xB3\x2C\x0B\x02\x83\x27\xB6\x34\x55\xF1\x30\x88\x1A"
-    "\xA8\x0D\x51\xE4\xFB\xBE\x0D\xD4\x98\xD5\x09\xA9\x98\x60\x70\x83\x11"
-    "\x47\xB5\xDF\x43\x4D\xCD\x1B\x86\x81\x07\x84\xE2\x10\x85\x4D\x08\x83"
-    "\xA0\x46\xF7\x57\x95\x77\x35\x1F\xD2\xDD\x95\xA7\x29\x72\x1B\x06\x74"
-    "\x65\xD1\xBA\xFC\x70\x93\xD7\xAD\xAF\xD3\x00\x41\x4E\x4D\x46\xFE\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00"
-    "\x00\x56\x50\x38\x4C\xE5\x00\x00\x00\x2F\x3F\xC0\x07\x00\xDF\xC0\x26"
-    "\x00\x80\x34\xF8\xA5\x1F\x2F\x04\xD0\x9B\x12\xF4\x22\xDD\x3A\xB8\x5E"
-    "\xDE\x84\x69\x64\x5B\xAD\x1E\xD1\x33\x28\x1C\x95\xA4\x0E\x28\x1B\x8D"
-    "\xC3\x33\x48\x70\xF9\x07\x36\x01\x00\x26\x99\xBB\x27\x58\x03\xFB\xD6"
-    "\x62\x4D\xC8\x48\x1B\x5E\x3E\x87\xF9\x0F\x00\x60\xF7\x5B\x3D\x6C\xC8"
-    "\x78\xFD\x45\xC0\x88\x32\x15\xB8\x60\xE5\x81\x3A\x13\x77\xE5\x03\xC2"
-    "\x83\x90\x0F\xF7\x31\x0D\xEF\x16\xE3\x8D\xFE\x57\x7E\x88\x1D\xE0\xE6"
-    "\x09\x6F\x85\x90\x4C\xEE\x37\x2D\xBA\x37\x7E\x80\x5A\xD4\x30\x59\x9D"
-    "\xC1\x95\x24\xC9\x4A\x54\xB8\xBB\xC3\xFD\x6F\xFA\xFA\x3D\x60\x7D\xBF"
-    "\x22\xFA\x3F\x01\xDC\x7C\xE3\xD1\xF7\x87\xFB\x5B\xCD\xB2\x2C\x08\x0C"
-    "\x9E\x68\xD3\x54\xC5\xF3\x2C\x6A\xA0\x36\x44\x91\xEF\xFB\x36\x50\x63"
-    "\x56\x03\xA4\x62\x85\xD9\x0D\x16\x1C\x55\x77\x0D\x35\x35\x8F\x30\xCF"
-    "\xDC\x20\x14\xBD\x28\x6C\x42\x98\x05\x35\x7A\x3A\xAB\xBC\xAA\x79\x1D"
-    "\x79\x9A\x22\xDB\x79\x46\x57\x16\xA3\xCB\x1F\xEE\xF1\x70\xC9\xC3\x69"
-    "\x00\x41\x4E\x4D\x46\xF8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xE0\x00\x00\x00\x2F"
-    "\x3F\xC0\x07\x00\xD7\xC0\x2A\xB2\xED\x26\xE9\x3D\x22\x22\x25\x91\x81"
-    "\x2D\x64\x31\x7C\xA3\xA0\xF7\xDE\xF1\xC1\xB6\xB6\x6D\x58\xE6\x59\x24"
-    "\xB3\x34\xA1\x04\x2A\x50\xB6\x58\x26\xD3\x01\x99\x3F\x7F\xB6\x91\x6D"
-    "\x2B\x79\xDF\x25\xFC\x7D\xB8\xD3\x24\x35\xD1\x0C\xF9\x0F\x71\xE6\x3F"
-    "\x00\x80\xD3\x9A\xA6\x35\xD9\xB1\x1B\x9A\xB0\xF5\x03\x42\x0B\xEB\x1E"
-    "\xEE\xE3\xD2\x0C\x6A\x0F\xFE\xFF\xC6\xC3\xE1\x53\x44\x7E\x6A\x0F\x03"
-    "\x2F\x30\x02\x7C\x88\x59\x24\x96\x20\x04\xF3\xC0\x3A\xEB\x27\xDE\xAB"
-    "\x22\xFD\xB2\x98\x44\x65\x63\x70\x25\x49\xB2\x12\x0D\x3C\xD6\x1D\x87"
-    "\xFB\x1F\xF5\xF5\x7B\xEB\xF6\x55\x13\xD1\xFF\x09\xB0\x3B\x2F\xEC\x4F"
-    "\xBD\x82\xBD\x47\x2E\x62\x0C\xAE\x36\x35\x62\x06\x3C\xB2\xE5\xE0\x9E"
-    "\x02\x33\x71\x75\x86\x20\x7A\xA8\xF3\xA0\x23\x53\x9D\x6E\xC3\x8C\xF3"
-    "\x08\x35\x76\x07\x3B\x71\x14\xCB\x94\x1D\xD4\x82\x19\xDD\x5E\x6B\x75"
-    "\xAB\xE1\x75\x2C\x82\x9B\x1C\x6B\x4C\xAF\x13\x9A\x9C\x3F\xEC\xF2\xE1"
-    "\x26\x01\x41\x4E\x4D\x46\xF0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xD8\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\xCF\xC0\x26\x00\xC0\x24\xF3\xE1\xAE\x17\x19\xB8"
-    "\x89\x4F\x02\x1A\xB8\x7D\xEE\x92\x83\x69\x00\x00\x69\xF0\xCE\x15\x34"
-    "\x4E\xB0\xAB\xA9\x44\xCE\x70\x1A\x6C\xC9\x8D\x4D\x00\x80\x49\xE6\xEE"
-    "\x51\x36\xE8\x45\x12\x6A\x51\x83\xD3\xE5\x75\xE6\x3F\x00\x00\xB3\xDF"
-    "\xAA\xC1\x80\x6C\xAF\xAB\x0A\x18\x52\x7E\x07\x2C\x7F\x59\x06\xF1\x7F"
-    "\x1D\x45\x08\x96\x3C\xA5\xEB\x2C\x8F\xBD\x71\x3D\x48\xA0\x31\x28\xAF"
-    "\xB5\xBF\xE4\x87\xD8\x05\x6C\x2C\x09\x61\x2D\x5E\x6E\x06\xCF\x8E\xF0"
-    "\x89\x5C\x0B\xAE\x24\x49\x52\xAA\xC2\xDD\x61\xE5\xFE\x57\x65\x9D\xA7"
-    "\x5F\x11\xFD\x9F\x00\x22\x1F\xF9\x53\xEF\xFB\xBE\x28\x6E\x32\xC3\x36"
-    "\x0C\xA6\x5A\x08\xC3\x02\x2C\x37\x55\x95\xE7\xB9\x0D\x2C\xDC\x9B\x4E"
-    "\x18\x0C\x0A\x84\x1B\x48\x1C\x4D\x7B\x18\x16\x16\x52\x10\x82\x08\x4A"
-    "\xC3\x61\x68\x6D\x4A\x10\x06\x16\xCC\x97\xAF\x26\xD4\xFA\x3A\xBA\x61"
-    "\xC0\xB8\x09\x81\x59\xFB\xFB\xC3\x9E\x92\x9B\x0D\x41\x4E\x4D\x46\xF0"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00"
-    "\x00\x00\x56\x50\x38\x4C\xD7\x00\x00\x00\x2F\x3F\xC0\x07\x00\xCF\xC0"
-    "\x26\x00\xC0\x24\xF3\xCF\x7D\x27\x11\xB8\x89\x48\x09\x22\x50\x85\x0E"
-    "\xAE\x97\x37\x61\x1A\xD9\x56\x2B\xB2\x67\x68\x80\x4A\x52\xC7\x58\x3A"
-    "\x40\xE3\x70\x19\x8B\xFB\x39\x30\x0E\x00\x40\xC5\x75\xF7\x28\xDA\xD6"
-    "\x56\x6A\xBE\x7E\xCD\xFC\x07\x00\x60\xF7\x5B\x3D\xD8\x90\xED\xF5\x77"
-    "\x01\x43\x2A\x4E\xC0\xC9\x1E\xCF\xB3\x33\x72\x57\x3A\x20\xD4\xE2\xE2"
-    "\x51\x7C\x4C\x8D\x76\x8B\xF2\x46\xFB\xAB\x7E\x88\x5D\xC0\xCD\x92\x0C"
-    "\x4B\xE5\xBA\x29\x9E\x79\xC3\xA7\xF1\x5E\xEB\x3A\x60\xDC\x46\x92\xA2"
-    "\x3A\x66\xE6\xFC\x53\x5D\xDE\xE3\x57\x44\xFF\x27\x00\xC7\x77\x7E\xEA"
-    "\x45\x51\x44\x91\x20\x90\xF4\x79\x2E\x4B\x97\x45\xD2\x02\xAD\x20\x49"
-    "\xC2\x30\x54\x81\x16\xB1\x6C\x82\x5C\xB2\xC1\xA2\x07\x2B\x9A\xB2\xC1"
-    "\x0E\x2D\x2D\x3E\x2C\x0B\x0E\xC4\x92\x51\x52\xA9\xC4\xB0\x48\x68\x91"
-    "\xCF\xA6\x6A\x5B\xDD\x75\x94\x79\x8E\xB4\x5F\x16\xE4\x8D\xB9\x1F\xF6"
-    "\xE1\x5D\x26\x01\x00\x41\x4E\x4D\x46\xE8\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xD0"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\xC7\xC0\x36\xB6\xAD\x44\x0C\x91\x17"
-    "\x41\x1B\x64\xD0\x39\xA1\x6F\x15\xEE\xEE\xDB\x87\xDA\xD8\xB6\xA1\x6F"
-    "\x5F\x32\x23\x53\x85\x16\xE8\x40\xD7\x62\x99\x02\xC4\xA4\x3B\xB5\x91"
-    "\x6C\x25\x1F\x97\x90\x3E\xC8\xBC\x0D\x86\x02\x29\x91\xD0\x61\xFE\x03"
-    "\x00\x9C\x46\x67\x19\xF6\x69\x22\x9F\xDA\xC3\xC1\x0B\x86\x46\x07\xEA"
-    "\x4E\x66\x18\x05\xD6\x99\x1F\x3E\xAB\xA1\x08\x5B\x1D\x20\xCE\xB8\x3D"
-    "\xC4\xE3\x62\x04\xB5\x03\xFF\xDF\x4C\x63\x8A\xF0\x9D\xA9\x90\xBE\x01"
-    "\xE3\x36\x92\x14\xD5\xF1\xD2\x31\x4D\xFE\xB1\xEE\x31\xDF\x2B\xA2\xFF"
-    "\x13\xC0\xCE\x47\x7E\xEA\x79\x9E\x87\xA1\x27\x9B\x18\x9C\x9B\x6A\x94"
-    "\x9A\x10\x40\x3C\x6D\x1B\x45\xD1\x1C\x10\xFC\x53\x29\xB8\x09\x0B\x6A"
-    "\x19\x18\x16\x4E\x25\xDB\x20\x08\x47\x50\x8A\x1D\x74\x13\xF1\x44\x39"
-    "\xA7\x03\x35\x81\x30\xAD\xD7\xAA\xB6\xEA\xAF\xA3\x70\x8E\xC9\x41\x29"
-    "\xA6\xEB\xF5\x7E\xF8\xC1\x04\x41\x4E\x4D\x46\xEA\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38"
-    "\x4C\xD2\x00\x00\x00\x2F\x3F\xC0\x07\x00\xC7\xC0\xA8\xB6\x6D\x25\xDF"
-    "\x7D\xA4\x48\x0A\x08\x47\x3E\x0D\xC0\xA2\x83\x4D\x6D\xE4\x39\x94\x46"
-    "\xB2\xD5\x3C\x14\x1A\x45\x09\x38\x34\x75\xD3\x40\xAA\x85\xC1\x25\x95"
-    "\x13\xDB\x00\x00\xCB\xC4\xC6\x2D\xF9\x7F\xCA\x84\xEA\x0E\x6B\x74\xE7"
-    "\x3F\x00\xC0\xF1\x5B\x13\x7A\xA4\xBD\xAE\x20\x60\x42\x25\x11\xB0\xF6"
-    "\x72\x26\xE2\x7F\x89\x11\x82\x95\xA7\xBE\x4E\x0A\x1E\x49\x85\x6C\xA5"
-    "\x33\x30\x6A\xFD\x35\x8A\x15\x5B\x40\x4D\x7F\xB9\x81\x12\x7F\xA8\x9E"
-    "\x57\xEA\x00\x8C\x24\x49\x52\x52\x6B\xB8\xCB\xC0\xFF\xDF\xBA\xB8\x73"
-    "\x8A\xE8\xFF\x04\xB0\xF3\x91\x9F\x7A\x92\x24\xC6\x78\xD4\x44\x97\xA6"
-    "\x53\x41\x59\x4E\x08\x20\x1E\xE7\xB4\xD6\x73\x40\xF0\x4F\xD5\x90\x4E"
-    "\xE4\x50\x2E\x83\x82\x85\x53\xCD\x36\x08\xC2\x11\xCA\x92\x1D\xD8\x89"
-    "\x76\x22\x9A\x63\xA1\x9C\x40\x98\xAE\xD6\x0A\xB7\xEA\xAF\x23\x4E\x53"
-    "\x26\xBB\xB2\x64\x7A\x58\xEF\x87\x9F\x4D\x00\x41\x4E\x4D\x46\xEA\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00"
-    "\x00\x56\x50\x38\x4C\xD1\x00\x00\x00\x2F\x3F\xC0\x07\x00\xC7\xC0\x28"
-    "\x92\x24\x45\xCB\xBC\x7B\x8C\x2E\x51\xDF\xC5\x29\x38\x13\xF4\xA5\x17"
-    "\xEB\x60\x1B\xD9\x56\xAA\x47\x44\x0A\x55\x90\x11\xD3\xBD\xD5\xC2\x90"
-    "\xB9\xCB\x17\xB6\x01\x00\xB2\xD1\xD9\x78\xD5\x5F\xFE\xE8\xDC\x61\x6A"
-    "\x63\x4D\xE6\x3F\x00\x80\x3E\x51\x86\xF8\x4C\x50\x91\xF1\x5C\x56\xC0"
-    "\x88\xCA\x1C\x10\xAA\xED\xF4\xC4\xFF\x59\x86\x09\x21\x5F\x4E\x6C\x48"
-    "\x81\x6C\xB1\x18\x29\xB5\xFE\x11\x85\x86\x1D\xA0\xC7\xBF\x52\x42\x99"
-    "\x99\xBA\x4F\xAA\x8A\x06\x46\x92\x24\x29\xA9\x35\xDC\x65\xE0\xFF\x6F"
-    "\x5D\xDC\x39\x45\xF4\x7F\x02\xD8\xB9\xE2\xA7\x9E\xA6\xA9\xB5\x1E\x3D"
-    "\xD1\x65\xD9\x54\x58\x96\x13\x02\x88\x27\x08\x8C\x31\x73\x40\xF0\x4F"
-    "\xD5\x90\x4D\xE4\x50\x2E\x83\x82\x85\x53\xCD\x36\x08\xC2\x11\xCA\x92"
-    "\x1D\xB8\x89\x76\x22\x9E\xE3\xA0\x9C\x40\x98\xAE\xD6\x8A\xB6\xEA\xAF"
-    "\x23\xC9\x32\x26\xBB\xB2\x64\x7A\x58\xEF\x87\x3F\x4E\x00\x00\x41\x4E"
-    "\x4D\x46\xE4\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xCC\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\xBF\xC0\x26\x92\x64\x55\x8F\x39\x62\x70\xF3\x44\x7D\x7D\x5F\xC2"
-    "\xAF\xEF\x81\x52\x8A\x58\x87\xD2\x48\xB6\x9A\xF7\xD5\xD7\xBF\x8A\xEF"
-    "\xD0\x74\x9F\x6A\x61\x70\x0C\x2E\x27\x36\x01\x00\xA4\xC1\x5D\x32\xD1"
-    "\x97\x1E\x0E\x39\x76\xD9\xE9\x9B\xFF\x00\x00\xC7\x6F\x4D\x58\x90\xF6"
-    "\xBA\x92\x80\x89\x4A\x19\xB0\xFE\x72\x16\xE2\x7F\x89\x51\xC1\x9A\xD3"
-    "\xC9\x91\xB4\xC8\x56\xA7\x41\xA8\xF5\x37\x14\x2B\xB6\x80\x9E\x7F\xD5"
-    "\x41\x29\x1E\xBA\xE7\xB5\x18\x80\x91\x24\x49\x4A\x6A\x0D\x77\x18\xF8"
-    "\xFF\x5F\x17\x77\xB8\x44\xF4\x7F\x02\xF8\x07\x26\x49\x62\x8C\x47\x8D"
-    "\xB4\x69\x3A\x16\x14\xC5\x88\x00\xE2\x71\x4E\x6B\x3D\x05\x04\xFF\x58"
-    "\x05\xE9\x48\x06\xC5\x3C\xC8\x99\x39\x56\xAF\x83\x20\xEC\xA1\x28\xD8"
-    "\x80\x1D\x69\x46\xA2\x29\x16\x8A\x11\x84\xF1\x72\xA9\x70\xAD\xEE\x3C"
-    "\xE2\x34\x65\xB4\x2D\x0A\xC6\xFB\xE5\x3E\xF8\xC3\x08\x41\x4E\x4D\x46"
-    "\xE8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A"
-    "\x00\x00\x00\x56\x50\x38\x4C\xCF\x00\x00\x00\x2F\x3F\xC0\x07\x00\xBF"
-    "\xC0\x26\x92\x64\x55\x8F\x39\x62\x88\x9E\xC9\xAF\xEF\x4B\xF8\xF5\x3D"
-    "\x50\x4A\x11\xEB\x50\x1A\xC9\x56\xF3\xBE\xFA\xFA\x57\x81\x43\xD3\x2E"
-    "\x95\xA4\x5A\x18\x1C\x83\xCB\x89\x71\x24\x5B\x89\x70\x97\x14\xC8\xBF"
-    "\xC8\xC3\x21\x8E\x3D\xD9\xD1\x77\xFE\x03\x00\x1C\xBF\x35\x61\x41\xDA"
-    "\xEB\x4A\x02\x26\x2A\x65\xC0\xFA\xCB\x59\x88\xFF\x25\x46\x09\x56\x9F"
-    "\x4E\x8E\xA4\x41\xB6\x3A\x0D\x42\xAD\xBF\xA1\x58\xB1\x05\xF4\xFC\xAB"
-    "\x0E\x4A\xF1\xD0\x3D\xAF\xD9\x00\x8C\x24\x49\x52\x52\x6B\xB8\xC3\xC0"
-    "\xFF\xFF\xBA\xB8\xC3\x25\xA2\xFF\x13\xC0\x3F\x30\x49\x12\x63\x3C\x6A"
-    "\xA4\x4D\xD3\xB1\xA0\x28\x46\x04\x10\x8F\x73\x5A\xEB\x29\x20\xF8\xC7"
-    "\x2A\x48\x47\x32\x28\xE6\x41\xCE\xCC\xB1\x7A\x1D\x04\x61\x0F\x45\xC1"
-    "\x06\xEC\x48\x33\x12\x4D\xB1\x50\x8C\x20\x8C\x97\x4B\x85\x6B\x75\xE7"
-    "\x11\xA7\x29\xA3\x6D\x51\x30\xDE\x2F\xF7\xC1\x1F\x46\x00\x00\x41\x4E"
-    "\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x29\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE"
-    "\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3"
-    "\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE"
-    "\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57"
-    "\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39"
-    "\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A"
-    "\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D"
-    "\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9"
-    "\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1"
-    "\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48"
-    "\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76"
-    "\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38"
-    "\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F"
-    "\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9"
-    "\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8"
-    "\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F"
-    "\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE"
-    "\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE"
-    "\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29"
-    "\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69"
-    "\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD"
-    "\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10"
-    "\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D"
-    "\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41"
-    "\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F"
-    "\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0"
-    "\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF"
-    "\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43"
-    "\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07"
-    "\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E"
-    "\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A"
-    "\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E"
-    "\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5"
-    "\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D"
-    "\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9"
-    "\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED"
-    "\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C"
-    "\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50"
-    "\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55"
-    "\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23"
-    "\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C"
-    "\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7"
-    "\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F"
-    "\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5"
-    "\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24"
-    "\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81"
-    "\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69"
-    "\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75"
-    "\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E"
-    "\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F"
-    "\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09"
-    "\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE"
-    "\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF"
-    "\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2"
-    "\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73"
-    "\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB"
-    "\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8"
-    "\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96"
-    "\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B"
-    "\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23"
-    "\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65"
-    "\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64"
-    "\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A"
-    "\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8"
-    "\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C"
-    "\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6"
-    "\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08"
-    "\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92"
-    "\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE"
-    "\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE"
-    "\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A"
-    "\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30"
-    "\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87"
-    "\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F"
-    "\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D"
-    "\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A"
-    "\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8"
-    "\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26"
-    "\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58"
-    "\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC"
-    "\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF"
-    "\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D"
-    "\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21"
-    "\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0"
-    "\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92"
-    "\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00"
-    "\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92"
-    "\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D"
-    "\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31"
-    "\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75"
-    "\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03"
-    "\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30"
-    "\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46"
-    "\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00"
-    "\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02"
-    "\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7"
-    "\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82"
-    "\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC"
-    "\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4"
-    "\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF"
-    "\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE"
-    "\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13"
-    "\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A"
-    "\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8"
-    "\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE"
-    "\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23"
-    "\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB"
-    "\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B"
-    "\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47"
-    "\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00"
-    "\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26"
-    "\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62"
-    "\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1"
-    "\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09"
-    "\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29"
-    "\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA"
-    "\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07"
-    "\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F"
-    "\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40"
-    "\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33"
-    "\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39"
-    "\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0"
-    "\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00"
-    "\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9"
-    "\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F"
-    "\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84"
-    "\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B"
-    "\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32"
-    "\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B"
-    "\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19"
-    "\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50"
-    "\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E"
-    "\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25"
-    "\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F"
-    "\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00"
-    "\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0"
-    "\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29"
-    "\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85"
-    "\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83"
-    "\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51"
-    "\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9"
-    "\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E"
-    "\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD"
-    "\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11"
-    "\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05"
-    "\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42"
-    "\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8"
-    "\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\xC6\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0"
-    "\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57"
-    "\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90"
-    "\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1"
-    "\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F"
-    "\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61"
-    "\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC"
-    "\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13"
-    "\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10"
-    "\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94"
-    "\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5"
-    "\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46"
-    "\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A"
-    "\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7"
-    "\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A"
-    "\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA"
-    "\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8"
-    "\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30"
-    "\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16"
-    "\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0"
-    "\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11"
-    "\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C"
-    "\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07"
-    "\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5"
-    "\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9"
-    "\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62"
-    "\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE"
-    "\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00"
-    "\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0"
-    "\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC"
-    "\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62"
-    "\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55"
-    "\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A"
-    "\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80"
-    "\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D"
-    "\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD"
-    "\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D"
-    "\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x29\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00"
-    "\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07"
-    "\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D"
-    "\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68"
-    "\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12"
-    "\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90"
-    "\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1"
-    "\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E"
-    "\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2"
-    "\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C"
-    "\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C"
-    "\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65"
-    "\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C"
-    "\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39"
-    "\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A"
-    "\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06"
-    "\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00"
-    "\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42"
-    "\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A"
-    "\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9"
-    "\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A"
-    "\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7"
-    "\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84"
-    "\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15"
-    "\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E"
-    "\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE"
-    "\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3"
-    "\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE"
-    "\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57"
-    "\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39"
-    "\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A"
-    "\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D"
-    "\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9"
-    "\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1"
-    "\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48"
-    "\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76"
-    "\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38"
-    "\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F"
-    "\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9"
-    "\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8"
-    "\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F"
-    "\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE"
-    "\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE"
-    "\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29"
-    "\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69"
-    "\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD"
-    "\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10"
-    "\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D"
-    "\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41"
-    "\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F"
-    "\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0"
-    "\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF"
-    "\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43"
-    "\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07"
-    "\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E"
-    "\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A"
-    "\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E"
-    "\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5"
-    "\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D"
-    "\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9"
-    "\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED"
-    "\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C"
-    "\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50"
-    "\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55"
-    "\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23"
-    "\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C"
-    "\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7"
-    "\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F"
-    "\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5"
-    "\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24"
-    "\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81"
-    "\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69"
-    "\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75"
-    "\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E"
-    "\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F"
-    "\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00"
-    "\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09"
-    "\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE"
-    "\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF"
-    "\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2"
-    "\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73"
-    "\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB"
-    "\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8"
-    "\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96"
-    "\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B"
-    "\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23"
-    "\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65"
-    "\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56"
-    "\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64"
-    "\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A"
-    "\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8"
-    "\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C"
-    "\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6"
-    "\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08"
-    "\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92"
-    "\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE"
-    "\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE"
-    "\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A"
-    "\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30"
-    "\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87"
-    "\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F"
-    "\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D"
-    "\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A"
-    "\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8"
-    "\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26"
-    "\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58"
-    "\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC"
-    "\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF"
-    "\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D"
-    "\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21"
-    "\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0"
-    "\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92"
-    "\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00"
-    "\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92"
-    "\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D"
-    "\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31"
-    "\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75"
-    "\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03"
-    "\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30"
-    "\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46"
-    "\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00"
-    "\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02"
-    "\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7"
-    "\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82"
-    "\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC"
-    "\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F"
-    "\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4"
-    "\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF"
-    "\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE"
-    "\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13"
-    "\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A"
-    "\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8"
-    "\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE"
-    "\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23"
-    "\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB"
-    "\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B"
-    "\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47"
-    "\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00"
-    "\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26"
-    "\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62"
-    "\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1"
-    "\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09"
-    "\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29"
-    "\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA"
-    "\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07"
-    "\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F"
-    "\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40"
-    "\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33"
-    "\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39"
-    "\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0"
-    "\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00"
-    "\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9"
-    "\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F"
-    "\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84"
-    "\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B"
-    "\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32"
-    "\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B"
-    "\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19"
-    "\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50"
-    "\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E"
-    "\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25"
-    "\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F"
-    "\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00"
-    "\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0"
-    "\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29"
-    "\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85"
-    "\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83"
-    "\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51"
-    "\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9"
-    "\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E"
-    "\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD"
-    "\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11"
-    "\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05"
-    "\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42"
-    "\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8"
-    "\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0"
-    "\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57"
-    "\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90"
-    "\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1"
-    "\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F"
-    "\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61"
-    "\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC"
-    "\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13"
-    "\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10"
-    "\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94"
-    "\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5"
-    "\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46"
-    "\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29"
-    "\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7"
-    "\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A"
-    "\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA"
-    "\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8"
-    "\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30"
-    "\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16"
-    "\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0"
-    "\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11"
-    "\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C"
-    "\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07"
-    "\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5"
-    "\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9"
-    "\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6"
-    "\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62"
-    "\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE"
-    "\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00"
-    "\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0"
-    "\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC"
-    "\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62"
-    "\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55"
-    "\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A"
-    "\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80"
-    "\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D"
-    "\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD"
-    "\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D"
-    "\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00"
-    "\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07"
-    "\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D"
-    "\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68"
-    "\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12"
-    "\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90"
-    "\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1"
-    "\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E"
-    "\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2"
-    "\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C"
-    "\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C"
-    "\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65"
-    "\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x29\x00\x00\x00\x56\x50\x38\x4C"
-    "\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39"
-    "\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A"
-    "\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06"
-    "\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00"
-    "\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42"
-    "\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A"
-    "\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9"
-    "\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A"
-    "\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7"
-    "\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84"
-    "\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15"
-    "\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E"
-    "\x4D\x46\xDE\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00"
-    "\x00\x2A\x00\x00\x00\x56\x50\x38\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\xB7\xC0\x26\x92\x64\x55\x8F\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE"
-    "\x07\x4A\x29\x62\x1D\x4A\x23\xD9\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3"
-    "\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE"
-    "\x68\xB8\x83\x09\x75\x6C\xE7\x3F\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57"
-    "\x12\x30\x51\x29\x03\xD6\x5F\xCE\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39"
-    "\x90\x16\xD9\xEA\x30\x08\xB5\xFE\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A"
-    "\xF1\xD0\x9E\x07\x46\x92\x24\x29\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D"
-    "\x2E\x11\xFD\x9F\x00\xFE\x81\x69\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9"
-    "\xB2\x1C\x11\x40\x02\xCE\x69\xAD\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1"
-    "\x9C\x07\x05\x33\xC7\x9A\x75\x10\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48"
-    "\x3C\xC5\x42\x39\x82\x30\x5E\x2D\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76"
-    "\x65\xC9\xF8\xB0\xDC\x87\x1F\x41\x4E\x4D\x46\xDE\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2A\x00\x00\x00\x56\x50\x38"
-    "\x4C\xC6\x00\x00\x00\x2F\x3F\xC0\x07\x00\xB7\xC0\x26\x92\x64\x55\x8F"
-    "\x39\x62\xF0\xF9\xF4\x3D\x09\xBF\xBE\x07\x4A\x29\x62\x1D\x4A\x23\xD9"
-    "\x6A\xDE\x57\x5F\xFF\x2A\xBE\x43\xD3\x7D\xAA\x85\xC1\x31\xB8\x9C\xD8"
-    "\x06\x00\x90\x84\xEE\xF8\xFF\x07\xFE\x68\xB8\x83\x09\x75\x6C\xE7\x3F"
-    "\x00\xC0\xF1\x5B\x13\x26\xD2\x5E\x57\x12\x30\x51\x29\x03\xD6\x5F\xCE"
-    "\x42\xFC\x2F\x32\x2A\x58\x73\x3A\x39\x90\x16\xD9\xEA\x30\x08\xB5\xFE"
-    "\x8A\x62\x61\x0B\xE8\xFC\xAB\x0E\x4A\xF1\xD0\x9E\x07\x46\x92\x24\x29"
-    "\xA9\x55\xDC\x19\xFE\xFF\xD8\xC5\x1D\x2E\x11\xFD\x9F\x00\xFE\x81\x69"
-    "\x9A\x1A\x13\x50\x23\x5D\x96\x8D\xF9\xB2\x1C\x11\x40\x02\xCE\x69\xAD"
-    "\xA7\x80\x10\x1E\xAB\x21\x1B\xC9\xA1\x9C\x07\x05\x33\xC7\x9A\x75\x10"
-    "\x84\x3D\x94\x25\x1B\xB0\x23\xED\x48\x3C\xC5\x42\x39\x82\x30\x5E\x2D"
-    "\x15\xAD\xD5\x9F\x47\x92\x65\x8C\x76\x65\xC9\xF8\xB0\xDC\x87\x1F";
\ No newline at end of file
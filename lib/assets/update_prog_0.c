@@ -1,129 +0,0 @@
-// Generated by 'tbt dev firmware-asset', don't edit manually!
-#include <stddef.h>
-#include <stdint.h>
-
-const size_t ASSET_OTA_PROG_0_LEN = 1968;
-const uint8_t ASSET_OTA_PROG_0_WEBP[] =
-    "\x52\x49\x46\x46\xA8\x07\x00\x00\x57\x45\x42\x50\x56\x50\x38\x58"
-    "\x0A\x00\x00\x00\x12\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x41\x4E"
-    "\x49\x4D\x06\x00\x00\x00\xFF\xFF\xFF\xFF\x00\x00\x41\x4E\x4D\x46"
-    "\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x32\x00\x00\x02\x56\x50\x38\x4C\x60\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\x0F\x30\xFF\xF3\x3F\xFF\xF3\x1F\x78\x70\x54\xDB\xB6\xD3\xDC"
-    "\xC5\xA8\x77\x46\x38\x01\x09\x9F\xD9\x57\x40\xF1\xD3\xAB\x80\xA7"
-    "\x00\x21\x35\x46\x58\x31\xD0\x7B\x22\x20\xA2\xFF\x13\x80\xFF\x4B"
-    "\x69\xE6\xF7\x2A\x40\x0D\x67\xA3\x0D\x90\xCB\xD9\x51\x00\xE8\x30"
-    "\x85\x9B\x07\x50\xC1\xD9\x66\x03\x43\xC4\x83\x5E\xC5\xFB\xF7\xD3"
-    "\x5D\xC3\xC4\x5D\xF1\x7B\xF6\xD3\x5D\x03\x5F\x0B\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x0C\x13\x31\x10\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x18"
-    "\x23\x32\x20\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2"
-    "\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A"
-    "\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x24\x33\x33\x31\xF3"
-    "\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00"
-    "\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00"
-    "\x2F\x0D\x40\x01\x10\x0F\x30\x30\x43\x34\x41\xF3\x1F\xF0\x10\x0B"
-    "\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x3C\x53\x35\x51\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x48"
-    "\x63\x36\x62\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2"
-    "\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A"
-    "\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x54\x73\x37\x72\xF3"
-    "\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00"
-    "\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00"
-    "\x2F\x0D\x40\x01\x10\x0F\x30\x60\x83\x38\x83\xF3\x1F\xF0\x10\x0B"
-    "\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x6D\x93\x39\x93\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x79"
-    "\xA3\x3A\xA3\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2"
-    "\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A"
-    "\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x85\xB3\x3B\xB4\xF3"
-    "\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00"
-    "\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00"
-    "\x2F\x0D\x40\x01\x10\x0F\x30\x91\xC3\x3C\xC4\xF3\x1F\xF0\x10\x0B"
-    "\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x9D\xD3\x3D\xD5\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\xA9"
-    "\xE3\x3E\xE5\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2"
-    "\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A"
-    "\x00\x00\x0D\x00\x00\x05\x00\x00\x64\x00\x00\x00\x56\x50\x38\x4C"
-    "\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\xB5\xF3\x3F\xF5\xF3"
-    "\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00"
-    "\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00"
-    "\x2F\x0D\x40\x01\x10\x0F\x30\xA9\xE3\x3E\xE5\xF3\x1F\xF0\x10\x0B"
-    "\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x9D\xD3\x3D\xD5\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x91"
-    "\xC3\x3C\xC4\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2"
-    "\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A"
-    "\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x85\xB3\x3B\xB4\xF3"
-    "\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00"
-    "\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00"
-    "\x2F\x0D\x40\x01\x10\x0F\x30\x79\xA3\x3A\xA3\xF3\x1F\xF0\x10\x0B"
-    "\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x6D\x93\x39\x93\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x60"
-    "\x83\x38\x83\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2"
-    "\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A"
-    "\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x54\x73\x37\x72\xF3"
-    "\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00"
-    "\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00"
-    "\x2F\x0D\x40\x01\x10\x0F\x30\x48\x63\x36\x62\xF3\x1F\xF0\x10\x0B"
-    "\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x3C\x53\x35\x51\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x30"
-    "\x43\x34\x41\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2"
-    "\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A"
-    "\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x24\x33\x33\x31\xF3"
-    "\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00"
-    "\x41\x4E\x4D\x46\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00"
-    "\x2F\x0D\x40\x01\x10\x0F\x30\x18\x23\x32\x20\xF3\x1F\xF0\x10\x0B"
-    "\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46"
-    "\x34\x00\x00\x00\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01"
-    "\x10\x0F\x30\x0C\x13\x31\x10\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97"
-    "\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x30\x00\x00\x00"
-    "\x02\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x17\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x10\x11"
-    "\xF3\x1F\x42\x2C\x98\xA0\xCD\x5F\xAA\x33\x86\x88\xFE\x47\x0E\x00";
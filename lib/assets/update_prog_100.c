@@ -1,188 +0,0 @@
-#include <stddef.h>
-#include <stdint.h>
-
-const size_t ASSET_OTA_PROG_100_LEN = 2924;
-const uint8_t ASSET_OTA_PROG_100_WEBP[] =
-    "\x52\x49\x46\x46\x64\x0B\x00\x00\x57\x45\x42\x50\x56\x50\x38\x58"
-    "\x0A\x00\x00\x00\x12\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x41\x4E"
-    "\x49\x4D\x06\x00\x00\x00\xFF\xFF\xFF\xFF\x00\x00\x41\x4E\x4D\x46"
-    "\x38\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2C\x01\x00\x02\x56\x50\x38\x4C\x20\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\x0F\x30\xFF\xF3\x3F\xFF\xF3\x1F\x78\x10\x08\x24\x08\xFB\x5B"
-    "\xAE\x91\x41\x44\xFF\x33\x9E\xE3\x39\x9E\xE3\x19\x41\x4E\x4D\x46"
-    "\x4A\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2C\x01\x00\x00\x56\x50\x38\x4C\x32\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x35\x6D\x1B\x41\x6A"
-    "\x31\x16\x64\x99\x3E\x37\xDD\x18\xD1\x7F\xB5\x6D\xDB\x30\x6E\x69"
-    "\x53\xDE\x90\x53\x82\xD7\xE9\x78\xE0\xF9\xE1\xFD\x7F\x03\x41\x4E"
-    "\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F"
-    "\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x35\x01\x40"
-    "\x30\x36\xF9\x34\x94\x76\x5D\xCE\x88\xFE\xAB\x6D\xDB\x86\x71\x4B"
-    "\x9B\xF2\x46\x48\x97\x59\x5D\x4A\x5C\x67\xB5\x87\xFD\xE5\xFD\x7F"
-    "\x0B\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C\x33\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80"
-    "\x07\x33\x01\x93\x54\x58\x04\xF2\xD0\x8B\xEC\xA8\x97\x67\x44\xFF"
-    "\xD5\xB6\x6D\xC3\xB8\xA5\x4D\x79\x43\x6C\xD3\x69\x89\xAE\x33\xF5"
-    "\xD0\x2F\xEF\xFF\x1B\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2C\x01\x00\x00\x56\x50"
-    "\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x10\x17\x30\xFF\xF3\x3F"
-    "\xFF\xF3\x1F\x80\x07\x35\x01\x90\x30\x29\x28\x41\x0A\xA2\xD1\x7E"
-    "\x78\x79\x46\xF4\x5F\x6D\xDB\x36\x8C\x5B\xDA\x94\x37\xAC\xEB\x24"
-    "\x52\xEA\xFC\x80\x78\x78\xFF\xDF\x04\x00\x41\x4E\x4D\x46\x4A\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2C\x01"
-    "\x00\x00\x56\x50\x38\x4C\x32\x00\x00\x00\x2F\x3F\xC0\x07\x10\x17"
-    "\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x35\x6D\x1B\x41\x6A\x31\x16"
-    "\x64\x99\x3E\x37\xDD\x18\xD1\x7F\xB5\x6D\xDB\x30\x6E\x69\x53\xDE"
-    "\x90\x53\x82\xD7\xE9\x78\xE0\xF9\xE1\xFD\x7F\x03\x41\x4E\x4D\x46"
-    "\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2C\x01\x00\x00\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x35\x01\x40\x30\x36"
-    "\xF9\x34\x94\x76\x5D\xCE\x88\xFE\xAB\x6D\xDB\x86\x71\x4B\x9B\xF2"
-    "\x46\x48\x97\x59\x5D\x4A\x5C\x67\xB5\x87\xFD\xE5\xFD\x7F\x0B\x00"
-    "\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C\x33\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x33"
-    "\x01\x93\x54\x58\x04\xF2\xD0\x8B\xEC\xA8\x97\x67\x44\xFF\xD5\xB6"
-    "\x6D\xC3\xB8\xA5\x4D\x79\x43\x6C\xD3\x69\x89\xAE\x33\xF5\xD0\x2F"
-    "\xEF\xFF\x1B\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x3F\x00\x00\x1F\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C"
-    "\x33\x00\x00\x00\x2F\x3F\xC0\x07\x10\x17\x30\xFF\xF3\x3F\xFF\xF3"
-    "\x1F\x80\x07\x35\x01\x90\x30\x29\x28\x41\x0A\xA2\xD1\x7E\x78\x79"
-    "\x46\xF4\x5F\x6D\xDB\x36\x8C\x5B\xDA\x94\x37\xAC\xEB\x24\x52\xEA"
-    "\xFC\x80\x78\x78\xFF\xDF\x04\x00\x41\x4E\x4D\x46\x4A\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2C\x01\x00\x00"
-    "\x56\x50\x38\x4C\x32\x00\x00\x00\x2F\x3F\xC0\x07\x10\x17\x30\xFF"
-    "\xF3\x3F\xFF\xF3\x1F\x80\x07\x35\x6D\x1B\x41\x6A\x31\x16\x64\x99"
-    "\x3E\x37\xDD\x18\xD1\x7F\xB5\x6D\xDB\x30\x6E\x69\x53\xDE\x00\xAF"
-    "\x53\x4E\xC9\xF3\x83\xE3\xE1\xFD\x7F\x0B\x41\x4E\x4D\x46\x4C\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2C\x01"
-    "\x00\x00\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x10\x17"
-    "\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x35\x01\x40\x30\x36\xF9\x34"
-    "\x94\x76\x5D\xCE\x88\xFE\xAB\x6D\xDB\x86\x71\x4B\x9B\xF2\x86\xC4"
-    "\x36\xB3\xBA\x0C\xB9\xCE\x6A\x0F\xFD\xE5\xFD\x7F\x07\x00\x41\x4E"
-    "\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F"
-    "\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F"
-    "\xC0\x07\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x33\x01\x93"
-    "\x54\x20\xC2\xF2\xD0\x8B\xEC\xA8\x97\x67\x44\xFF\xD5\xB6\x6D\xC3"
-    "\xB8\xA5\x4D\x79\x43\xB4\x74\x5A\xA2\xEB\x4C\x3D\xEC\x2F\xEF\xFF"
-    "\x1B\x00\x41\x4E\x4D\x46\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x3F\x00\x00\x1F\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C\x33\x00"
-    "\x00\x00\x2F\x3F\xC0\x07\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80"
-    "\x07\x35\x01\x90\x30\x29\x28\x41\x0A\xA2\xD1\x7E\x78\x79\x46\xF4"
-    "\x5F\x6D\xDB\x36\x8C\x5B\xDA\x94\x37\x88\x94\xD6\x75\x22\x1E\x74"
-    "\x7E\x78\xFF\xDF\x06\x00\x41\x4E\x4D\x46\x4A\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2C\x01\x00\x00\x56\x50"
-    "\x38\x4C\x32\x00\x00\x00\x2F\x3F\xC0\x07\x10\x17\x30\xFF\xF3\x3F"
-    "\xFF\xF3\x1F\x80\x07\x35\x6D\x1B\x41\x6A\x31\x16\x64\x99\x3E\x37"
-    "\xDD\x18\xD1\x7F\xB5\x6D\xDB\x30\x6E\x69\x53\xDE\x00\xAF\x53\x4E"
-    "\xC9\xF3\x83\xE3\xE1\xFD\x7F\x0B\x41\x4E\x4D\x46\x4C\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x2C\x01\x00\x00"
-    "\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07\x10\x17\x30\xFF"
-    "\xF3\x3F\xFF\xF3\x1F\x80\x07\x35\x01\x40\x30\x36\xF9\x34\x94\x76"
-    "\x5D\xCE\x88\xFE\xAB\x6D\xDB\x86\x71\x4B\x9B\xF2\x86\xC4\x36\xB3"
-    "\xBA\x0C\xB9\xCE\x6A\x0F\xFD\xE5\xFD\x7F\x07\x00\x41\x4E\x4D\x46"
-    "\x4C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x2C\x01\x00\x00\x56\x50\x38\x4C\x33\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x10\x17\x30\xFF\xF3\x3F\xFF\xF3\x1F\x80\x07\x33\x01\x93\x54\x20"
-    "\xC2\xF2\xD0\x8B\xEC\xA8\x97\x67\x44\xFF\xD5\xB6\x6D\xC3\xB8\xA5"
-    "\x4D\x79\x43\xB4\x74\x5A\xA2\xEB\x4C\x3D\xEC\x2F\xEF\xFF\x1B\x00"
-    "\x41\x4E\x4D\x46\x38\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00"
-    "\x00\x1F\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C\x1F\x00\x00\x00"
-    "\x2F\x3F\xC0\x07\x10\x0F\x10\x11\xF3\x1F\x82\x20\xDB\x46\xBB\x06"
-    "\x57\xFF\x0C\x22\xFA\x9F\x00\xCB\xF2\xB2\xBC\x2C\x2F\xBB\x01\x00"
-    "\x41\x4E\x4D\x46\x6C\x00\x00\x00\x09\x00\x00\x02\x00\x00\x18\x00"
-    "\x00\x19\x00\x00\x58\x02\x00\x00\x56\x50\x38\x4C\x54\x00\x00\x00"
-    "\x2F\x18\x40\x06\x10\x0F\x10\xF3\x1F\xF3\x1F\x0C\x56\xB1\x6D\x2B"
-    "\x39\xEF\xE1\xDE\xC0\x29\xC9\x1F\x37\x01\x15\xA8\x42\x13\xA7\x83"
-    "\xBB\x45\x88\xE8\xBF\x90\x20\xC1\xEA\x92\x72\x70\xE1\xEB\xF1\x8B"
-    "\x32\x89\x91\xAB\x31\x7C\xED\xB1\x8C\x2E\xFE\x27\x82\xA1\x75\x36"
-    "\x70\x4A\x61\x17\x1B\x13\x49\xBD\xE1\xB4\x31\x9B\x00\x10\x98\x4A"
-    "\x60\x7D\xB6\x31\x41\x4E\x4D\x46\x6C\x00\x00\x00\x09\x00\x00\x02"
-    "\x00\x00\x18\x00\x00\x19\x00\x00\x58\x02\x00\x00\x56\x50\x38\x4C"
-    "\x53\x00\x00\x00\x2F\x18\x40\x06\x10\x0F\x10\x11\xF3\x1F\x82\x55"
-    "\x6C\xDB\x4A\xCE\x7B\xB8\x37\x70\x4A\xF2\xC7\x4D\x40\x05\xAA\xD0"
-    "\xC4\xE9\xE0\x6E\x11\x22\xFA\x2F\x24\x48\xB0\xBA\xA4\x1C\x5C\xF8"
-    "\x7A\xFC\xA2\x4C\x62\xE4\x6A\x0C\x5F\x7B\x2C\xA3\x8B\xFF\x89\x60"
-    "\x68\x9D\x0D\x9C\x52\xD8\xC5\xC6\x44\x52\x6F\x38\x6D\xCC\x26\x00"
-    "\x04\xA6\x12\x58\x9F\x6D\x0C\x00\x41\x4E\x4D\x46\x6C\x00\x00\x00"
-    "\x09\x00\x00\x02\x00\x00\x18\x00\x00\x19\x00\x00\x58\x02\x00\x00"
-    "\x56\x50\x38\x4C\x54\x00\x00\x00\x2F\x18\x40\x06\x10\x0F\x10\xF3"
-    "\x1F\xF3\x1F\x0C\x56\xB1\x6D\x2B\x39\xEF\xE1\xDE\xC0\x29\xC9\x1F"
-    "\x37\x01\x15\xA8\x42\x13\xA7\x83\xBB\x45\x88\xE8\xBF\x90\x20\xC1"
-    "\xEA\x92\x72\x70\xE1\xEB\xF1\x8B\x32\x89\x91\xAB\x31\x7C\xED\xB1"
-    "\x8C\x2E\xFE\x27\x82\xA1\x75\x36\x70\x4A\x61\x17\x1B\x13\x49\xBD"
-    "\xE1\xB4\x31\x9B\x00\x10\x98\x4A\x60\x7D\xB6\x31\x41\x4E\x4D\x46"
-    "\x6C\x00\x00\x00\x09\x00\x00\x02\x00\x00\x18\x00\x00\x19\x00\x00"
-    "\x58\x02\x00\x00\x56\x50\x38\x4C\x53\x00\x00\x00\x2F\x18\x40\x06"
-    "\x10\x0F\x10\x11\xF3\x1F\x82\x55\x6C\xDB\x4A\xCE\x7B\xB8\x37\x70"
-    "\x4A\xF2\xC7\x4D\x40\x05\xAA\xD0\xC4\xE9\xE0\x6E\x11\x22\xFA\x2F"
-    "\x24\x48\xB0\xBA\xA4\x1C\x5C\xF8\x7A\xFC\xA2\x4C\x62\xE4\x6A\x0C"
-    "\x5F\x7B\x2C\xA3\x8B\xFF\x89\x60\x68\x9D\x0D\x9C\x52\xD8\xC5\xC6"
-    "\x44\x52\x6F\x38\x6D\xCC\x26\x00\x04\xA6\x12\x58\x9F\x6D\x0C\x00"
-    "\x41\x4E\x4D\x46\x82\x00\x00\x00\x08\x00\x00\x02\x00\x00\x1D\x00"
-    "\x00\x19\x00\x00\x58\x02\x00\x00\x56\x50\x38\x4C\x69\x00\x00\x00"
-    "\x2F\x1D\x40\x06\x10\x0F\x30\xFF\x11\xF3\x1F\x0C\xB6\x11\x00\xB8"
-    "\xF8\x2C\x54\x7F\x2A\x9D\xBB\x1C\xCA\xAF\x74\x56\x30\x82\x35\x74"
-    "\x4E\xA5\x34\x80\xEA\x47\x30\x89\x2D\xD8\x21\x67\x46\x88\xE8\xFF"
-    "\x04\xB4\xC3\x64\xCB\x50\xF5\xAB\xBB\xB8\x1A\x8A\xB8\xB3\x55\x21"
-    "\x5D\x55\xC8\x50\xB5\xDB\x71\xB2\xC1\xEF\x8D\x45\x00\xE7\x33\xAE"
-    "\x2D\x84\x12\xBE\x29\x7D\x6A\x93\xCC\xB0\x49\xAD\xAF\x4A\xA2\x20"
-    "\x50\xEA\x88\xE4\x02\x11\x13\xAF\x0A\x00\x41\x4E\x4D\x46\x80\x00"
-    "\x00\x00\x08\x00\x00\x02\x00\x00\x1D\x00\x00\x19\x00\x00\x58\x02"
-    "\x00\x00\x56\x50\x38\x4C\x68\x00\x00\x00\x2F\x1D\x40\x06\x10\x0F"
-    "\x10\x11\xF3\x1F\x82\x6D\x04\x00\x2E\x3E\x0B\xD5\x9F\x4A\xE7\x2E"
-    "\x87\xF2\x2B\x9D\x15\x8C\x60\x0D\x9D\x53\x29\x0D\xA0\xFA\x11\x4C"
-    "\x62\x0B\x76\xC8\x99\x11\x22\xFA\x3F\x01\xED\x30\xD9\x32\x54\xFD"
-    "\xEA\x2E\xAE\x86\x22\xEE\x6C\x55\x48\x57\x15\x32\x54\xED\x76\x9C"
-    "\x6C\xF0\x7B\x63\x11\xC0\xF9\x8C\x6B\x0B\xA1\x84\x6F\x4A\x9F\xDA"
-    "\x24\x33\x6C\x52\xEB\xAB\x92\x28\x08\x94\x3A\x22\xB9\x40\xC4\xC4"
-    "\xAB\x02\x41\x4E\x4D\x46\x82\x00\x00\x00\x08\x00\x00\x02\x00\x00"
-    "\x1D\x00\x00\x19\x00\x00\x58\x02\x00\x00\x56\x50\x38\x4C\x69\x00"
-    "\x00\x00\x2F\x1D\x40\x06\x10\x0F\x30\xFF\x11\xF3\x1F\x0C\xB6\x11"
-    "\x00\xB8\xF8\x2C\x54\x7F\x2A\x9D\xBB\x1C\xCA\xAF\x74\x56\x30\x82"
-    "\x35\x74\x4E\xA5\x34\x80\xEA\x47\x30\x89\x2D\xD8\x21\x67\x46\x88"
-    "\xE8\xFF\x04\xB4\xC3\x64\xCB\x50\xF5\xAB\xBB\xB8\x1A\x8A\xB8\xB3"
-    "\x55\x21\x5D\x55\xC8\x50\xB5\xDB\x71\xB2\xC1\xEF\x8D\x45\x00\xE7"
-    "\x33\xAE\x2D\x84\x12\xBE\x29\x7D\x6A\x93\xCC\xB0\x49\xAD\xAF\x4A"
-    "\xA2\x20\x50\xEA\x88\xE4\x02\x11\x13\xAF\x0A\x00\x41\x4E\x4D\x46"
-    "\x80\x00\x00\x00\x08\x00\x00\x02\x00\x00\x1D\x00\x00\x19\x00\x00"
-    "\x58\x02\x00\x00\x56\x50\x38\x4C\x68\x00\x00\x00\x2F\x1D\x40\x06"
-    "\x10\x0F\x10\x11\xF3\x1F\x82\x6D\x04\x00\x2E\x3E\x0B\xD5\x9F\x4A"
-    "\xE7\x2E\x87\xF2\x2B\x9D\x15\x8C\x60\x0D\x9D\x53\x29\x0D\xA0\xFA"
-    "\x11\x4C\x62\x0B\x76\xC8\x99\x11\x22\xFA\x3F\x01\xED\x30\xD9\x32"
-    "\x54\xFD\xEA\x2E\xAE\x86\x22\xEE\x6C\x55\x48\x57\x15\x32\x54\xED"
-    "\x76\x9C\x6C\xF0\x7B\x63\x11\xC0\xF9\x8C\x6B\x0B\xA1\x84\x6F\x4A"
-    "\x9F\xDA\x24\x33\x6C\x52\xEB\xAB\x92\x28\x08\x94\x3A\x22\xB9\x40"
-    "\xC4\xC4\xAB\x02\x41\x4E\x4D\x46\x72\x00\x00\x00\x09\x00\x00\x02"
-    "\x00\x00\x18\x00\x00\x19\x00\x00\x58\x02\x00\x00\x56\x50\x38\x4C"
-    "\x5A\x00\x00\x00\x2F\x18\x40\x06\x10\x0F\x10\x31\xFF\xF3\x1F\x0C"
-    "\xB7\xB5\xB6\xAD\xC9\xFB\x76\x71\x9F\x22\x13\xB8\x75\x19\xCB\x83"
-    "\xC3\x08\x3E\x08\x35\xEB\x90\xD2\x2A\x64\x84\x88\xFE\x0B\x09\x12"
-    "\x6C\x4E\x89\xF2\x81\x45\xEE\xE0\x93\x97\x0F\xF8\xBE\xA3\xF3\x9B"
-    "\xF8\x3B\x83\xC4\xAC\x2F\x30\xAA\x12\xDB\xE7\xC2\xD7\x49\xA0\x5B"
-    "\x09\x94\xEA\x85\x28\x81\x71\x05\x3E\x5A\x70\x3E\x2D\x04\x41\x4E"
-    "\x4D\x46\x72\x00\x00\x00\x09\x00\x00\x02\x00\x00\x18\x00\x00\x19"
-    "\x00\x00\x58\x02\x00\x00\x56\x50\x38\x4C\x59\x00\x00\x00\x2F\x18"
-    "\x40\x06\x10\x0F\x10\x11\xF3\x1F\xC2\x6D\xAD\x6D\x6B\xF2\xBE\x5D"
-    "\xDC\xA7\xC8\x04\x6E\x5D\xC6\xF2\xE0\x30\x82\x0F\x42\xCD\x3A\xA4"
-    "\xB4\x0A\x19\x21\xA2\xFF\x42\x82\x04\x9B\x53\xA2\x7C\x60\x91\x3B"
-    "\xF8\xE4\xE5\x03\xBE\xEF\xE8\xFC\x26\xFE\xCE\x20\x31\xEB\x0B\x8C"
-    "\xAA\xC4\xF6\xB9\xF0\x75\x12\xE8\x56\x02\xA5\x7A\x21\x4A\x60\x5C"
-    "\x81\x8F\x16\x9C\x4F\x0B\x01\x00\x41\x4E\x4D\x46\x72\x00\x00\x00"
-    "\x09\x00\x00\x02\x00\x00\x18\x00\x00\x19\x00\x00\x58\x02\x00\x00"
-    "\x56\x50\x38\x4C\x5A\x00\x00\x00\x2F\x18\x40\x06\x10\x0F\x10\x31"
-    "\xFF\xF3\x1F\x0C\xB7\xB5\xB6\xAD\xC9\xFB\x76\x71\x9F\x22\x13\xB8"
-    "\x75\x19\xCB\x83\xC3\x08\x3E\x08\x35\xEB\x90\xD2\x2A\x64\x84\x88"
-    "\xFE\x0B\x09\x12\x6C\x4E\x89\xF2\x81\x45\xEE\xE0\x93\x97\x0F\xF8"
-    "\xBE\xA3\xF3\x9B\xF8\x3B\x83\xC4\xAC\x2F\x30\xAA\x12\xDB\xE7\xC2"
-    "\xD7\x49\xA0\x5B\x09\x94\xEA\x85\x28\x81\x71\x05\x3E\x5A\x70\x3E"
-    "\x2D\x04\x41\x4E\x4D\x46\x72\x00\x00\x00\x09\x00\x00\x02\x00\x00"
-    "\x18\x00\x00\x19\x00\x00\x2C\x01\x00\x00\x56\x50\x38\x4C\x59\x00"
-    "\x00\x00\x2F\x18\x40\x06\x10\x0F\x10\x11\xF3\x1F\xC2\x6D\xAD\x6D"
-    "\x6B\xF2\xBE\x5D\xDC\xA7\xC8\x04\x6E\x5D\xC6\xF2\xE0\x30\x82\x0F"
-    "\x42\xCD\x3A\xA4\xB4\x0A\x19\x21\xA2\xFF\x42\x82\x04\x9B\x53\xA2"
-    "\x7C\x60\x91\x3B\xF8\xE4\xE5\x03\xBE\xEF\xE8\xFC\x26\xFE\xCE\x20"
-    "\x31\xEB\x0B\x8C\xAA\xC4\xF6\xB9\xF0\x75\x12\xE8\x56\x02\xA5\x7A"
-    "\x21\x4A\x60\x5C\x81\x8F\x16\x9C\x4F\x0B\x01\x00";
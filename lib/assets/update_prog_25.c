@@ -1,130 +0,0 @@
-// Generated by 'tbt dev firmware-asset', don't edit manually!
-#include <stddef.h>
-#include <stdint.h>
-
-const size_t ASSET_OTA_PROG_25_LEN = 1978;
-const uint8_t ASSET_OTA_PROG_25_WEBP[] =
-    "\x52\x49\x46\x46\xB2\x07\x00\x00\x57\x45\x42\x50\x56\x50\x38\x58"
-    "\x0A\x00\x00\x00\x12\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x41\x4E"
-    "\x49\x4D\x06\x00\x00\x00\xFF\xFF\xFF\xFF\x00\x00\x41\x4E\x4D\x46"
-    "\x82\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x32\x00\x00\x02\x56\x50\x38\x4C\x69\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\x17\x20\x10\x48\xF2\x07\x5A\x6F\x8D\xF9\x17\x12\x24\xFC\x1F"
-    "\x6C\x75\xFE\x03\xBF\x04\x6C\x1B\x49\x52\x34\x27\xCD\xF9\x9C\xC4"
-    "\x47\x71\xE8\x3F\x06\xF9\x1F\x27\xA3\x1D\xD1\xFF\x09\xC0\x0F\x56"
-    "\x45\xBA\x31\x44\xE9\x63\xBB\xA1\x22\x75\x51\xAC\x14\x1B\x62\x65"
-    "\x22\xD6\x64\x37\xB6\x55\xB1\x2B\x62\x0D\x91\xBA\x28\x76\x5C\x09"
-    "\x11\x8E\xBA\x48\x1F\x5B\x3C\x72\x3A\x08\xCC\xCB\xD2\x60\x3B\xBC"
-    "\xD1\x74\x10\xEF\x0B\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x0C\x13\x31"
-    "\x10\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x18\x23\x32\x20\xF3\x1F\xF0"
-    "\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E"
-    "\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D"
-    "\x40\x01\x10\x0F\x30\x24\x33\x33\x31\xF3\x1F\xF0\x10\x0B\x26\x68"
-    "\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00"
-    "\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F"
-    "\x30\x30\x43\x34\x41\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C"
-    "\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x3C\x53\x35"
-    "\x51\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x48\x63\x36\x62\xF3\x1F\xF0"
-    "\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E"
-    "\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D"
-    "\x40\x01\x10\x0F\x30\x54\x73\x37\x72\xF3\x1F\xF0\x10\x0B\x26\x68"
-    "\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00"
-    "\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F"
-    "\x30\x60\x83\x38\x83\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C"
-    "\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x6D\x93\x39"
-    "\x93\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x79\xA3\x3A\xA3\xF3\x1F\xF0"
-    "\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E"
-    "\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D"
-    "\x40\x01\x10\x0F\x30\x85\xB3\x3B\xB4\xF3\x1F\xF0\x10\x0B\x26\x68"
-    "\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00"
-    "\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F"
-    "\x30\x91\xC3\x3C\xC4\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C"
-    "\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x9D\xD3\x3D"
-    "\xD5\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\xA9\xE3\x3E\xE5\xF3\x1F\xF0"
-    "\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E"
-    "\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05"
-    "\x00\x00\x64\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D"
-    "\x40\x01\x10\x0F\x30\xB5\xF3\x3F\xF5\xF3\x1F\xF0\x10\x0B\x26\x68"
-    "\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00"
-    "\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F"
-    "\x30\xA9\xE3\x3E\xE5\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C"
-    "\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x9D\xD3\x3D"
-    "\xD5\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x91\xC3\x3C\xC4\xF3\x1F\xF0"
-    "\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E"
-    "\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D"
-    "\x40\x01\x10\x0F\x30\x85\xB3\x3B\xB4\xF3\x1F\xF0\x10\x0B\x26\x68"
-    "\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00"
-    "\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F"
-    "\x30\x79\xA3\x3A\xA3\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C"
-    "\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x6D\x93\x39"
-    "\x93\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x60\x83\x38\x83\xF3\x1F\xF0"
-    "\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E"
-    "\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D"
-    "\x40\x01\x10\x0F\x30\x54\x73\x37\x72\xF3\x1F\xF0\x10\x0B\x26\x68"
-    "\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00"
-    "\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F"
-    "\x30\x48\x63\x36\x62\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C"
-    "\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x3C\x53\x35"
-    "\x51\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x30\x43\x34\x41\xF3\x1F\xF0"
-    "\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E"
-    "\x4D\x46\x34\x00\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D"
-    "\x40\x01\x10\x0F\x30\x24\x33\x33\x31\xF3\x1F\xF0\x10\x0B\x26\x68"
-    "\xF3\x97\xEA\x8C\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00"
-    "\x00\x00\x09\x00\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F"
-    "\x30\x18\x23\x32\x20\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C"
-    "\x21\xA2\xFF\x91\x03\x00\x41\x4E\x4D\x46\x34\x00\x00\x00\x09\x00"
-    "\x00\x0A\x00\x00\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x1B\x00\x00\x00\x2F\x0D\x40\x01\x10\x0F\x30\x0C\x13\x31"
-    "\x10\xF3\x1F\xF0\x10\x0B\x26\x68\xF3\x97\xEA\x8C\x21\xA2\xFF\x91"
-    "\x03\x00\x41\x4E\x4D\x46\x30\x00\x00\x00\x09\x00\x00\x0A\x00\x00"
-    "\x0D\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x17\x00"
-    "\x00\x00\x2F\x0D\x40\x01\x10\x0F\x10\x11\xF3\x1F\x42\x2C\x98\xA0"
-    "\xCD\x5F\xAA\x33\x86\x88\xFE\x47\x0E\x00";
\ No newline at end of file
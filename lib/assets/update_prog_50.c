@@ -1,110 +0,0 @@
-#include <stddef.h>
-#include <stdint.h>
-
-const size_t ASSET_OTA_PROG_50_LEN = 1674;
-const uint8_t ASSET_OTA_PROG_50_WEBP[] =
-    "\x52\x49\x46\x46\x82\x06\x00\x00\x57\x45\x42\x50\x56\x50\x38\x58"
-    "\x0A\x00\x00\x00\x02\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x41\x4E"
-    "\x49\x4D\x06\x00\x00\x00\xFF\xFF\xFF\xFF\x00\x00\x41\x4E\x4D\x46"
-    "\x7E\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x32\x00\x00\x02\x56\x50\x38\x4C\x66\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\x17\x20\x10\x48\xF2\x07\x5A\x6F\x8D\xF9\x17\x12\x24\xFC\x1F"
-    "\x6C\x75\xFE\x03\xBF\x04\x6C\x1B\x49\x52\x34\x27\xCD\xF9\x9C\x0F"
-    "\xFB\xF7\x14\xE4\x7F\x9C\x8C\x76\x44\xFF\x27\x00\x3F\x58\x15\xE9"
-    "\xC6\x10\xA5\x8F\x6D\x43\x45\xEA\xA2\x58\x29\x36\xC4\xCA\x44\xAC"
-    "\xC9\x6E\x6C\x55\xB1\x2B\x62\x0D\x91\xBA\x28\x76\x5C\x09\x11\x8E"
-    "\xBA\x48\x1F\x1B\x1E\x39\x1D\x04\xE6\x65\x15\xAB\xE1\x8D\xA6\x83"
-    "\x78\x5F\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00"
-    "\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00"
-    "\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x86\x46\x14\xA2\xFF\x81\x88"
-    "\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A"
-    "\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x8C\x8A\x14\xA4\xFF"
-    "\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x92\xCE\x34"
-    "\xA6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x98"
-    "\x12\x35\xA8\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\x50\x9E\x56\x35\xAA\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\x50\xA4\x9A\x55\xAC\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E"
-    "\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C"
-    "\x40\x01\x00\x07\x50\xAA\xDE\x55\xAE\xFF\x81\x88\xE8\x7F\x00\x00"
-    "\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00"
-    "\x2F\x0C\x40\x01\x00\x07\x50\xB0\x22\x76\xB0\xFF\x81\x88\xE8\x7F"
-    "\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00"
-    "\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00"
-    "\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xB6\x66\x76\xB2\xFF\x81\x88"
-    "\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A"
-    "\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xBC\xAA\x76\xB4\xFF"
-    "\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xC2\xEE\x96"
-    "\xB6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xC8"
-    "\x32\x97\xB8\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\xD0\xCE\x76\xB7\xBA\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\xD0\xD4\xBA\xB7\xBC\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E"
-    "\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05"
-    "\x00\x00\x64\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C"
-    "\x40\x01\x00\x07\xD0\xDA\xFE\xB7\xBE\xFF\x81\x88\xE8\x7F\x00\x00"
-    "\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00"
-    "\x2F\x0C\x40\x01\x00\x07\xD0\xD4\xBA\xB7\xBC\xFF\x81\x88\xE8\x7F"
-    "\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00"
-    "\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00"
-    "\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xCE\x76\xB7\xBA\xFF\x81\x88"
-    "\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A"
-    "\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xC8\x32\x97\xB8\xFF"
-    "\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xC2\xEE\x96"
-    "\xB6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xBC"
-    "\xAA\x76\xB4\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\xD0\xB6\x66\x76\xB2\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\x50\xB0\x22\x76\xB0\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E"
-    "\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C"
-    "\x40\x01\x00\x07\x50\xAA\xDE\x55\xAE\xFF\x81\x88\xE8\x7F\x00\x00"
-    "\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00"
-    "\x2F\x0C\x40\x01\x00\x07\x50\xA4\x9A\x55\xAC\xFF\x81\x88\xE8\x7F"
-    "\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A\x00\x00"
-    "\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00"
-    "\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x9E\x56\x35\xAA\xFF\x81\x88"
-    "\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00\x00\x0A"
-    "\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x98\x12\x35\xA8\xFF"
-    "\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x10\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x92\xCE\x34"
-    "\xA6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x8C"
-    "\x8A\x14\xA4\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\x50\x86\x46\x14\xA2\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x26\x00\x00\x00\x10\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x0E\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\x10\x11\xFD\x0F\x44\x44\xFF\x03";
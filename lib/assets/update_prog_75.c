@@ -1,110 +0,0 @@
-#include <stddef.h>
-#include <stdint.h>
-
-const size_t ASSET_OTA_PROG_75_LEN = 1678;
-const uint8_t ASSET_OTA_PROG_75_WEBP[] =
-    "\x52\x49\x46\x46\x86\x06\x00\x00\x57\x45\x42\x50\x56\x50\x38\x58"
-    "\x0A\x00\x00\x00\x02\x00\x00\x00\x3F\x00\x00\x1F\x00\x00\x41\x4E"
-    "\x49\x4D\x06\x00\x00\x00\xFF\xFF\xFF\xFF\x00\x00\x41\x4E\x4D\x46"
-    "\x82\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x00\x00\x1F\x00\x00"
-    "\x32\x00\x00\x02\x56\x50\x38\x4C\x6A\x00\x00\x00\x2F\x3F\xC0\x07"
-    "\x00\x17\x20\x10\x48\xF2\x07\x5A\x6F\x8D\xF9\x17\x12\x24\xFC\x1F"
-    "\x6C\x75\xFE\x03\xBF\x04\x6C\x23\xDB\x56\x72\xFF\x8C\xFF\x48\x80"
-    "\x7E\xBE\xE6\x68\x91\x50\xA7\x6B\x1C\xD1\xFF\x09\xC0\x0F\x36\x99"
-    "\xD5\xA3\x0F\xAC\x09\xED\x86\x09\xD4\x66\x43\x0B\x25\x1B\x64\x65"
-    "\xA2\x58\x63\xDD\xD8\x16\x43\xBB\x4C\xD6\x10\xA8\xCD\x86\x76\x74"
-    "\xC5\x07\xD4\xD4\x66\xD6\x84\x16\x8F\x9C\x0E\x02\xF3\xB2\xAD\x01"
-    "\xFF\x46\xD3\x41\xBC\x2F\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x86\x46\x14"
-    "\xA2\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x8C"
-    "\x8A\x14\xA4\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\x50\x92\xCE\x34\xA6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\x50\x98\x12\x35\xA8\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E"
-    "\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C"
-    "\x40\x01\x00\x07\x50\x9E\x56\x35\xAA\xFF\x81\x88\xE8\x7F\x00\x00"
-    "\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00"
-    "\x2F\x0C\x40\x01\x00\x07\x50\xA4\x9A\x55\xAC\xFF\x81\x88\xE8\x7F"
-    "\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00"
-    "\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00"
-    "\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\xAA\xDE\x55\xAE\xFF\x81\x88"
-    "\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A"
-    "\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\xB0\x22\x76\xB0\xFF"
-    "\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xB6\x66\x76"
-    "\xB2\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xBC"
-    "\xAA\x76\xB4\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\xD0\xC2\xEE\x96\xB6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\xD0\xC8\x32\x97\xB8\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E"
-    "\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C"
-    "\x40\x01\x00\x07\xD0\xCE\x76\xB7\xBA\xFF\x81\x88\xE8\x7F\x00\x00"
-    "\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00"
-    "\x2F\x0C\x40\x01\x00\x07\xD0\xD4\xBA\xB7\xBC\xFF\x81\x88\xE8\x7F"
-    "\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00"
-    "\x0C\x00\x00\x05\x00\x00\x64\x00\x00\x00\x56\x50\x38\x4C\x11\x00"
-    "\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xDA\xFE\xB7\xBE\xFF\x81\x88"
-    "\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A"
-    "\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xD4\xBA\xB7\xBC\xFF"
-    "\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xCE\x76\xB7"
-    "\xBA\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\xD0\xC8"
-    "\x32\x97\xB8\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\xD0\xC2\xEE\x96\xB6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\xD0\xBC\xAA\x76\xB4\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E"
-    "\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C"
-    "\x40\x01\x00\x07\xD0\xB6\x66\x76\xB2\xFF\x81\x88\xE8\x7F\x00\x00"
-    "\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00"
-    "\x2F\x0C\x40\x01\x00\x07\x50\xB0\x22\x76\xB0\xFF\x81\x88\xE8\x7F"
-    "\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00"
-    "\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00"
-    "\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\xAA\xDE\x55\xAE\xFF\x81\x88"
-    "\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A"
-    "\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C"
-    "\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\xA4\x9A\x55\xAC\xFF"
-    "\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00\x17\x00"
-    "\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50"
-    "\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x9E\x56\x35"
-    "\xAA\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00\x00\x00"
-    "\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00\x00\x00"
-    "\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07\x50\x98"
-    "\x12\x35\xA8\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46\x2A\x00"
-    "\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00\x32\x00"
-    "\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01\x00\x07"
-    "\x50\x92\xCE\x34\xA6\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E\x4D\x46"
-    "\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05\x00\x00"
-    "\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C\x40\x01"
-    "\x00\x07\x50\x8C\x8A\x14\xA4\xFF\x81\x88\xE8\x7F\x00\x00\x41\x4E"
-    "\x4D\x46\x2A\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00\x00\x05"
-    "\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x11\x00\x00\x00\x2F\x0C"
-    "\x40\x01\x00\x07\x50\x86\x46\x14\xA2\xFF\x81\x88\xE8\x7F\x00\x00"
-    "\x41\x4E\x4D\x46\x26\x00\x00\x00\x17\x00\x00\x0A\x00\x00\x0C\x00"
-    "\x00\x05\x00\x00\x32\x00\x00\x00\x56\x50\x38\x4C\x0E\x00\x00\x00"
-    "\x2F\x0C\x40\x01\x00\x07\x10\x11\xFD\x0F\x44\x44\xFF\x03";
@@ -0,0 +1,124 @@
+#include "asset_store.h"
+
+#include <esp_log.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include <string.h>
+
+static const char *TAG = "asset_store";
+
+#define ASSET_PARTITION "assets"
+#define ASSET_MAGIC "TBA1"
+#define ASSET_NAME_LEN 20
+
+// See extra_scripts/pack_assets.py
+typedef struct {
+  char magic[4];
+  uint32_t count;
+  uint32_t crc;  // Of the entries
+  uint32_t reserved;
+} asset_header_t;
+
+typedef struct {
+  char name[ASSET_NAME_LEN];  // NUL padded
+  uint32_t offset;            // From the partition start
+  uint32_t len;
+  uint32_t crc;
+} asset_entry_t;
+
+// Built into the firmware for devices without an assets partition. OTA
+// updates keep the partition table a device was flashed with, those still
+// show OTA progress. The boot screen is too big to carry twice.
+#define EMBEDDED(n)                                \
+  extern const uint8_t _binary_##n##_webp_start[]; \
+  extern const uint8_t _binary_##n##_webp_end[];
+EMBEDDED(ota_prog_0)
+EMBEDDED(ota_prog_25)
+EMBEDDED(ota_prog_50)
+EMBEDDED(ota_prog_75)
+EMBEDDED(ota_prog_100)
+#undef EMBEDDED
+
+#define EMBEDDED(n) {#n, _binary_##n##_webp_start, _binary_##n##_webp_end}
+static const struct {
+  const char *name;
+  const uint8_t *start, *end;
+} _embedded[] = {
+    EMBEDDED(ota_prog_0),  EMBEDDED(ota_prog_25),  EMBEDDED(ota_prog_50),
+    EMBEDDED(ota_prog_75), EMBEDDED(ota_prog_100),
+};
+#undef EMBEDDED
+
+static struct {
+  const uint8_t *base;
+  size_t size;
+  const asset_entry_t *entries;
+  uint32_t count;
+  esp_partition_mmap_handle_t map;
+} _assets;
+
+int asset_store_init(void) {
+  if (_assets.base) return 0;
+
+  const esp_partition_t *part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, ASSET_PARTITION);
+  if (!part) {
+    ESP_LOGE(TAG, "no %s partition", ASSET_PARTITION);
+    return 1;
+  }
+  const void *p;
+  if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &p,
+                         &_assets.map) != ESP_OK) {
+    ESP_LOGE(TAG, "could not map the %s partition", ASSET_PARTITION);
+    return 1;
+  }
+
+  const asset_header_t *hdr = p;
+  const asset_entry_t *entries = (const asset_entry_t *)(hdr + 1);
+  const size_t max_count = (part->size - sizeof(*hdr)) / sizeof(*entries);
+  if (memcmp(hdr->magic, ASSET_MAGIC, sizeof(hdr->magic)) != 0 ||
+      hdr->count > max_count ||
+      esp_rom_crc32_le(0, (const uint8_t *)entries,
+                       hdr->count * sizeof(*entries)) != hdr->crc) {
+    ESP_LOGE(TAG, "%s partition holds no assets, was it flashed?",
+             ASSET_PARTITION);
+    esp_partition_munmap(_assets.map);
+    return 1;
+  }
+
+  _assets.size = part->size;
+  _assets.entries = entries;
+  _assets.count = hdr->count;
+  _assets.base = p;
+  ESP_LOGI(TAG, "%lu assets mapped", _assets.count);
+  return 0;
+}
+
+static const uint8_t *asset_embedded(const char *name, size_t *len) {
+  for (size_t i = 0; i < sizeof(_embedded) / sizeof(_embedded[0]); i++) {
+    if (strcmp(_embedded[i].name, name) == 0) {
+      *len = _embedded[i].end - _embedded[i].start;
+      return _embedded[i].start;
+    }
+  }
+  return NULL;
+}
+
+const uint8_t *asset_store_get(const char *name, size_t *len) {
+  for (uint32_t i = 0; i < _assets.count; i++) {
+    const asset_entry_t *e = &_assets.entries[i];
+    if (strncmp(e->name, name, ASSET_NAME_LEN) != 0) continue;
+
+    const uint8_t *data = _assets.base + e->offset;
+    if (e->offset > _assets.size || e->len > _assets.size - e->offset ||
+        esp_rom_crc32_le(0, data, e->len) != e->crc) {
+      ESP_LOGE(TAG, "asset %s is damaged", name);
+      return asset_embedded(name, len);
+    }
+    *len = e->len;
+    return data;
+  }
+  const uint8_t *data = asset_embedded(name, len);
+  if (!data) ESP_LOGW(TAG, "no asset %s", name);
+  return data;
+}
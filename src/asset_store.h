@@ -0,0 +1,17 @@
+#pragma once
+
+// Read only assets (boot screen, OTA progress) from the "assets"
+// partition, memory mapped so they're used straight from flash. The image
+// is packed from lib/assets by extra_scripts/pack_assets.py, which also
+// describes the layout, and can be flashed without the firmware.
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Map the partition and check its index, returns 0 on success
+int asset_store_init(void);
+
+// A named asset (its file name without .webp), valid until reboot. The
+// OTA progress frames are built in as well and stand in for missing or
+// damaged ones. NULL if there's no such asset.
+const uint8_t *asset_store_get(const char *name, size_t *len);
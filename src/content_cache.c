@@ -0,0 +1,275 @@
+#include "content_cache.h"
+
+#include <esp_log.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <nvs.h>
+#include <string.h>
+
+#include "mem_pool.h"
+#include "util.h"
+
+static const char *TAG = "content_cache";
+
+#define CACHE_PARTITION "imgcache"
+#define CACHE_NVS_NAMESPACE "content_cache"
+#define CACHE_NVS_KEY "index"
+#define CACHE_MAGIC 0x31435743  // "CWC1"
+
+// Flash erases in sectors, records start on one
+#define CACHE_SECTOR 4096
+#define CACHE_ALIGN(x) (((x) + CACHE_SECTOR - 1) & ~(CACHE_SECTOR - 1))
+
+#define CACHE_TASK_PRIO (tskIDLE_PRIORITY + 1)
+#define CACHE_TASK_STACK_SIZE 3072
+
+// Ahead of every image on flash, the NVS index is a copy of the newest
+typedef struct {
+  uint32_t magic;
+  uint32_t seq;  // Bumped for every record written
+  uint32_t off;  // Where the record starts in the partition
+  uint32_t len;  // Image bytes following the header
+  uint32_t crc;  // CRC32 of the image
+  webp_meta_t meta;
+} cache_record_t;
+
+static struct {
+  const esp_partition_t *part;
+  cache_record_t current;  // Newest record, magic is 0 while there's none
+  uint32_t head;           // Where the next record goes
+  uint32_t pinned_off, pinned_len;  // Mapped as the boot image, left alone
+  esp_partition_mmap_handle_t map;
+  const uint8_t *boot;
+  // Next image to write, newer ones replace it
+  uint8_t *pending;
+  size_t pending_len;
+  uint32_t pending_crc;
+  webp_meta_t pending_meta;
+  portMUX_TYPE lock;  // current and pending, shared with the writer task
+  TaskHandle_t task;
+} _cache = {.lock = portMUX_INITIALIZER_UNLOCKED};
+
+static void content_cache_task(void *arg);
+
+static inline uint32_t record_bytes(const cache_record_t *r) {
+  return r->magic == CACHE_MAGIC ? sizeof(*r) + r->len : 0;
+}
+
+int content_cache_init(void) {
+  _cache.part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                         ESP_PARTITION_SUBTYPE_ANY,
+                                         CACHE_PARTITION);
+  if (!_cache.part) {
+    ESP_LOGW(TAG, "no %s partition, not caching images", CACHE_PARTITION);
+    return 1;
+  }
+
+  nvs_handle_t h;
+  if (nvs_open(CACHE_NVS_NAMESPACE, NVS_READONLY, &h) == ESP_OK) {
+    cache_record_t idx;
+    size_t size = sizeof(idx);
+    if (nvs_get_blob(h, CACHE_NVS_KEY, &idx, &size) == ESP_OK &&
+        size == sizeof(idx) && idx.magic == CACHE_MAGIC &&
+        idx.off + sizeof(idx) + idx.len <= _cache.part->size) {
+      _cache.current = idx;
+    }
+    nvs_close(h);
+  }
+  _cache.head = CACHE_ALIGN(_cache.current.off + record_bytes(&_cache.current));
+  if (_cache.head >= _cache.part->size) _cache.head = 0;
+
+  if (xTaskCreate(content_cache_task, "content_cache", CACHE_TASK_STACK_SIZE,
+                  NULL, CACHE_TASK_PRIO, &_cache.task) != pdPASS) {
+    ESP_LOGE(TAG, "could not create content cache task");
+    return 1;
+  }
+  ESP_LOGI(TAG, "%lu bytes, newest record #%lu (%lu bytes)",
+           _cache.part->size, _cache.current.seq, _cache.current.len);
+  return 0;
+}
+
+bool content_cache_boot(const uint8_t **webp, size_t *len, webp_meta_t *meta) {
+  const cache_record_t *idx = &_cache.current;
+  if (!_cache.part || idx->magic != CACHE_MAGIC) return false;
+
+  if (!_cache.boot) {
+    const void *p;
+    if (esp_partition_mmap(_cache.part, idx->off, record_bytes(idx),
+                           ESP_PARTITION_MMAP_DATA, &p,
+                           &_cache.map) != ESP_OK) {
+      ESP_LOGW(TAG, "could not map record #%lu", idx->seq);
+      return false;
+    }
+    // The header must match the index and the image its CRC, anything else
+    // is a write that didn't finish
+    const uint8_t *data = (const uint8_t *)p + sizeof(*idx);
+    if (memcmp(p, idx, sizeof(*idx)) != 0 ||
+        esp_rom_crc32_le(0, data, idx->len) != idx->crc) {
+      ESP_LOGW(TAG, "record #%lu doesn't check out", idx->seq);
+      esp_partition_munmap(_cache.map);
+      return false;
+    }
+    _cache.pinned_off = idx->off;
+    _cache.pinned_len = record_bytes(idx);
+    _cache.boot = data;
+  }
+
+  *webp = _cache.boot;
+  *len = idx->len;
+  if (meta) *meta = idx->meta;
+  return true;
+}
+
+void content_cache_store(const uint8_t *webp, size_t len,
+                         const webp_meta_t *meta) {
+  if (!_cache.task || !webp || !len) return;
+  // Has to fit twice, the newest record stays put while the next goes in
+  if (sizeof(cache_record_t) + len > _cache.part->size / 2) {
+    ESP_LOGD(TAG, "%zu bytes is too big to cache", len);
+    return;
+  }
+
+  const uint32_t crc = esp_rom_crc32_le(0, webp, len);
+  taskENTER_CRITICAL(&_cache.lock);
+  bool known = (_cache.current.crc == crc && _cache.current.len == len) ||
+               (_cache.pending && _cache.pending_crc == crc &&
+                _cache.pending_len == len);
+  taskEXIT_CRITICAL(&_cache.lock);
+  if (known) return;
+
+  // Only from a spare block, the incoming body, the rotation and the
+  // readers come first
+  uint8_t *copy = mem_pool_try_alloc_bulk(len);
+  if (!copy) {
+    ESP_LOGD(TAG, "no spare block for %zu bytes, not caching", len);
+    return;
+  }
+  memcpy(copy, webp, len);
+
+  taskENTER_CRITICAL(&_cache.lock);
+  uint8_t *old = _cache.pending;
+  _cache.pending = copy;
+  _cache.pending_len = len;
+  _cache.pending_crc = crc;
+  _cache.pending_meta = meta ? *meta : (webp_meta_t){0};
+  taskEXIT_CRITICAL(&_cache.lock);
+
+  mem_pool_free(old);
+  xTaskNotifyGive(_cache.task);
+}
+
+// Sector aligned spot for n bytes from the head on, clear of the newest
+// record and the mapped one. False if they leave no room.
+static bool cache_place(uint32_t n, uint32_t *out) {
+  const uint32_t busy[][2] = {
+      {_cache.current.off, record_bytes(&_cache.current)},
+      {_cache.pinned_off, _cache.pinned_len},
+  };
+  uint32_t at = _cache.head;
+  for (int tries = 0; tries < 6; tries++) {
+    if (at + n > _cache.part->size) at = 0;
+    bool clear = true;
+    for (int i = 0; i < 2 && clear; i++) {
+      const uint32_t end = busy[i][0] + busy[i][1];
+      if (busy[i][1] && at < end && busy[i][0] < at + n) {
+        at = CACHE_ALIGN(end);
+        clear = false;
+      }
+    }
+    if (clear) {
+      *out = at;
+      return true;
+    }
+  }
+  return false;
+}
+
+static int cache_write(const uint8_t *webp, size_t len, uint32_t crc,
+                       const webp_meta_t *meta) {
+  const uint32_t n = sizeof(cache_record_t) + len;
+  uint32_t off;
+  if (!cache_place(n, &off)) {
+    ESP_LOGW(TAG, "no room for %zu bytes", len);
+    return 1;
+  }
+
+  cache_record_t rec;
+  memset(&rec, 0, sizeof(rec));  // Padding too, boot compares it
+  rec.magic = CACHE_MAGIC;
+  rec.seq = _cache.current.seq + 1;
+  rec.off = off;
+  rec.len = len;
+  rec.crc = crc;
+  rec.meta = *meta;
+
+  // A sector at a time, the caches are off while the flash is busy and the
+  // display tasks need a look in
+  esp_err_t err = ESP_OK;
+  for (uint32_t s = 0; s < CACHE_ALIGN(n) && err == ESP_OK; s += CACHE_SECTOR) {
+    err = esp_partition_erase_range(_cache.part, off + s, CACHE_SECTOR);
+    vTaskDelay(1);
+  }
+  if (err == ESP_OK) {
+    err = esp_partition_write(_cache.part, off, &rec, sizeof(rec));
+  }
+  for (uint32_t s = 0; s < len && err == ESP_OK; s += CACHE_SECTOR) {
+    err = esp_partition_write(_cache.part, off + sizeof(rec) + s, webp + s,
+                              MIN(len - s, CACHE_SECTOR));
+    vTaskDelay(1);
+  }
+
+  // The record only counts once the index points at it
+  nvs_handle_t h;
+  if (err == ESP_OK) {
+    err = nvs_open(CACHE_NVS_NAMESPACE, NVS_READWRITE, &h);
+  }
+  if (err == ESP_OK) {
+    err = nvs_set_blob(h, CACHE_NVS_KEY, &rec, sizeof(rec));
+    if (err == ESP_OK) err = nvs_commit(h);
+    nvs_close(h);
+  }
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "writing record at 0x%lx failed: %s", off,
+             esp_err_to_name(err));
+    return 1;
+  }
+
+  taskENTER_CRITICAL(&_cache.lock);
+  _cache.current = rec;
+  taskEXIT_CRITICAL(&_cache.lock);
+  _cache.head = CACHE_ALIGN(off + n);
+  ESP_LOGI(TAG, "stored record #%lu, %zu bytes at 0x%lx", rec.seq, len, off);
+  return 0;
+}
+
+static void content_cache_task(void *arg) {
+  const TickType_t interval = pdMS_TO_TICKS(CONTENT_CACHE_WRITE_SECS * 1000);
+  TickType_t last_write = 0;
+  bool written = false;
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // Rate limit, whatever arrives meanwhile replaces the pending image
+    if (written) {
+      TickType_t since = xTaskGetTickCount() - last_write;
+      if (since < interval) vTaskDelay(interval - since);
+    }
+
+    taskENTER_CRITICAL(&_cache.lock);
+    uint8_t *buf = _cache.pending;
+    size_t len = _cache.pending_len;
+    uint32_t crc = _cache.pending_crc;
+    webp_meta_t meta = _cache.pending_meta;
+    _cache.pending = NULL;
+    taskEXIT_CRITICAL(&_cache.lock);
+    if (!buf) continue;
+
+    cache_write(buf, len, crc, &meta);
+    mem_pool_free(buf);
+    last_write = xTaskGetTickCount();
+    written = true;
+  }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+// The last image we were sent, kept on flash so a reboot comes straight
+// back to it instead of the "no apps" screen. Records go round the
+// "imgcache" partition, the NVS index points at the newest. Writes are held
+// back and rate limited, flash wears and stalls the caches while it's busy.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gfx.h"
+
+// Shortest time between two flash writes, later images replace the pending
+// one meanwhile
+#ifndef CONTENT_CACHE_WRITE_SECS
+#define CONTENT_CACHE_WRITE_SECS (10 * 60)
+#endif
+
+// Find the partition and load the index, NVS must be up. Returns 0 if the
+// cache is usable, even when it holds nothing yet.
+int content_cache_init(void);
+
+// Last known good image, memory mapped from flash and valid until reboot.
+// False if there is none or it doesn't check out.
+bool content_cache_boot(const uint8_t **webp, size_t *len, webp_meta_t *meta);
+
+// Queue an image for the flash. It's copied, webp stays with the caller.
+// Images we already have on flash are ignored.
+void content_cache_store(const uint8_t *webp, size_t len,
+                         const webp_meta_t *meta);
@@ -2,10 +2,15 @@
 
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include "display_blit.h"
 #include "driver/gpio.h"
 #include "pinsmap.h"
+#include "util.h"
 
 static MatrixPanel_I2S_DMA *_matrix;
 static const char *TAG = "display";
@@ -13,6 +18,20 @@ static uint8_t _brightness = DISPLAY_DEFAULT_BRIGHTNESS;
 static uint8_t _dsplay_night_state = 0;  // Defaults to on.
 static uint8_t _dsplay_state = 1;        // Defaults to on.
 
+// Row hashes of what each DMA buffer holds, so unchanged rows are skipped
+static uint32_t _row_hash[2][DISPLAY_HEIGHT];
+static bool _row_hash_valid[2];
+static uint8_t _front;  // Buffer currently shown
+// Palette the hashed rows were drawn with
+static const gfx_palette_q_t *_palette;
+static display_stats_t _stats;
+
+// Panel content is no longer known, e.g. after a clear.
+static inline void invalidate_rows() {
+  _row_hash_valid[0] = false;
+  _row_hash_valid[1] = false;
+}
+
 // Helper function to toggle the display by toggling the LED matrix MOSFET
 void toggle_display_night_mode() {
   uint8_t new_level = !_dsplay_night_state;
@@ -55,8 +74,8 @@ int display_initialize() {
 #endif
 
   HUB75_I2S_CFG mxconfig(
-      64,                     // width
-      32,                     // height
+      DISPLAY_WIDTH,          // width
+      DISPLAY_HEIGHT,         // height
       1,                      // chain length
       pins,                   // pin mapping
       driver,                 // driver chip
@@ -77,6 +96,7 @@ int display_initialize() {
     return 1;
   }
   _matrix->fillScreenRGB888(0, 0, 0);
+  invalidate_rows();
 
   return 0;
 }
@@ -114,31 +134,161 @@ void display_set_brightness(uint8_t brightness_pct) {
     _matrix->setBrightness8(brightness_8bit);
     _brightness = brightness_pct;
     _matrix->clearScreen();
+    invalidate_rows();
   }
 }
 
 uint8_t get_brightness() { return _brightness; }
 
-// void display_draw(const uint8_t *pix, int width, int height,
-// 		  int channels, int ixR, int ixG, int ixB) {
-//   for (unsigned int i = 0; i < height; i++) {
-//     for (unsigned int j = 0; j < width; j++) {
-//       const uint8_t *p = &pix[(i * width + j) * channels];
-//       uint8_t r = p[ixR];
-//       uint8_t g = p[ixG];
-//       uint8_t b = p[ixB];
-//       _matrix->drawPixelRGB888(j, i, r, g, b);
-//     }
-//   }
-//   _matrix->flipDMABuffer();
-// }
+// Pixel pipeline for one row with the source layout and the enabled stages
+// fixed at compile time, so the loop carries no per-pixel lookups or stage
+// checks: channel order, palette matrix, row hash and span building all
+// happen in the one pass over the decoded pixels. Same output as the generic
+// display_row_runs().
+//
+// Brightness and gamma aren't stages here, the driver does both (OE duty
+// and its CIE table) while packing bit-planes. Alpha needs no work either,
+// the decoder hands us premultiplied rgbA.
+template <int Channels, int IxR, int IxG, int IxB, bool Palette>
+static void pipeline_row(const uint8_t *row, int width,
+                         const display_pixfmt_t *, const gfx_palette_q_t *q,
+                         display_row_t *out) {
+  out->hash = DISPLAY_HASH_SEED;
+  out->nruns = 0;
+
+  const uint8_t *p = row;
+  for (int x = 0; x < width; x++, p += Channels) {
+    uint8_t r = p[IxR], g = p[IxG], b = p[IxB];
+    if (Palette) gfx_palette_px_q(q, &r, &g, &b);
+    display_row_push(out, x, r, g, b);
+  }
+}
+
+static void pipeline_row_generic(const uint8_t *row, int width,
+                                 const display_pixfmt_t *fmt,
+                                 const gfx_palette_q_t *q,
+                                 display_row_t *out) {
+  display_row_runs(row, width, fmt, q, out);
+}
+
+typedef void (*pipeline_fn)(const uint8_t *, int, const display_pixfmt_t *,
+                            const gfx_palette_q_t *, display_row_t *);
+
+#define PIPELINE(C, R, G, B)                                 \
+  {{C, R, G, B},                                             \
+   pipeline_row<C, R, G, B, false>,                          \
+   pipeline_row<C, R, G, B, true>}
+
+// Layouts we have a specialised kernel for
+static const struct {
+  display_pixfmt_t fmt;
+  pipeline_fn plain, palette;
+} _pipelines[] = {
+    PIPELINE(4, 0, 1, 2),  // rgbA from the WebP decoder
+    PIPELINE(4, 2, 1, 0),
+    PIPELINE(3, 0, 1, 2),
+    PIPELINE(3, 2, 1, 0),
+};
+
+static pipeline_fn pick_pipeline(const display_pixfmt_t *fmt, bool palette) {
+  for (const auto &p : _pipelines) {
+    if (p.fmt.channels == fmt->channels && p.fmt.ix_r == fmt->ix_r &&
+        p.fmt.ix_g == fmt->ix_g && p.fmt.ix_b == fmt->ix_b) {
+      return palette ? p.palette : p.plain;
+    }
+  }
+  return pipeline_row_generic;
+}
+
+static inline void draw_row(const display_row_t *row, int y) {
+  auto m = _matrix;
+  for (int i = 0; i < row->nruns; i++) {
+    const display_run_t *r = &row->runs[i];
+    m->drawFastHLine(r->x, y, r->len, r->r, r->g, r->b);
+  }
+}
 
 void display_draw(const uint8_t *pix, int width, int height, int channels,
                   int ixR, int ixG, int ixB) {
+  display_draw_region(pix, width, height, channels, ixR, ixG, ixB, NULL, 0,
+                      height);
+}
+
+// With double buffering the back buffer holds the frame before last, so a
+// row is re-encoded when it differs from *that*, not from what's on screen.
+// Rows outside [y0, y1) are known to match the front buffer and reuse its
+// hash, unless the palette changed. If nothing differs from the front
+// buffer the flip is skipped; the back buffer then matches it anyway.
+void display_draw_region(const uint8_t *pix, int width, int height,
+                         int channels, int ixR, int ixG, int ixB,
+                         const gfx_palette_q_t *palette, int y0, int y1) {
   if (!pix) {
     ESP_LOGE(TAG, "Can't draw invalid webP pixels!");
     return;
   }
+  if (palette && palette->identity) palette = NULL;
+
+  const int rowStride = width * channels;
+  const int w = MIN(width, DISPLAY_WIDTH);
+  const int h = MIN(height, DISPLAY_HEIGHT);
+  const int back = _front ^ 1;
+  const uint32_t *front_hash = _row_hash[_front];
+  const bool front_valid = _row_hash_valid[_front] && palette == _palette;
+  uint32_t *back_hash = _row_hash[back];
+  const bool back_valid = _row_hash_valid[back] && palette == _palette;
+  const display_pixfmt_t fmt = {(uint8_t)channels, (uint8_t)ixR,
+                                (uint8_t)ixG, (uint8_t)ixB};
+  const pipeline_fn pipeline = pick_pipeline(&fmt, palette != NULL);
+  display_row_t row;
+  bool changed = !front_valid;
+
+  _stats.frames++;
+  for (int y = 0; y < h; y++) {
+    const bool known = front_valid && (y < y0 || y >= y1);
+    if (known && back_valid && back_hash[y] == front_hash[y]) continue;
+
+    pipeline(pix + y * rowStride, w, &fmt, palette, &row);
+    changed |= row.hash != front_hash[y];
+    if (back_valid && row.hash == back_hash[y]) continue;
+    draw_row(&row, y);
+    back_hash[y] = row.hash;
+    _stats.rows++;
+  }
+  _row_hash_valid[back] = true;
+  _palette = palette;
+
+  if (!changed) {
+    _stats.skipped++;
+    return;
+  }
+  _matrix->flipDMABuffer();
+  _front = back;
+}
+
+void display_get_stats(display_stats_t *out) {
+  if (out) *out = _stats;
+}
+
+#ifdef DISPLAY_BENCHMARK
+static void draw_runs(const uint8_t *pix, int width, int height, int channels,
+                      int ixR, int ixG, int ixB,
+                      const gfx_palette_q_t *palette) {
+  const int rowStride = width * channels;
+  const int w = MIN(width, DISPLAY_WIDTH);
+  const int h = MIN(height, DISPLAY_HEIGHT);
+  const display_pixfmt_t fmt = {(uint8_t)channels, (uint8_t)ixR,
+                                (uint8_t)ixG, (uint8_t)ixB};
+  const pipeline_fn pipeline = pick_pipeline(&fmt, palette != NULL);
+  display_row_t row;
+  for (int y = 0; y < h; y++) {
+    pipeline(pix + y * rowStride, w, &fmt, palette, &row);
+    draw_row(&row, y);
+  }
+}
+
+// Reference path: every pixel goes through the driver's bit-plane packing
+static void draw_pixels(const uint8_t *pix, int width, int height,
+                        int channels, int ixR, int ixG, int ixB) {
   const int rowStride = width * channels;
   auto m = _matrix;
   for (int y = 0; y < height; y++) {
@@ -150,49 +300,55 @@ void display_draw(const uint8_t *pix, int width, int height, int channels,
       m->drawPixelRGB888(x, y, p[ixR], p[ixG], p[ixB]);
     }
   }
-  m->flipDMABuffer();
-}
-
-// void display_draw(const uint8_t *pix, int width, int height, int channels,
-//                   int ixR, int ixG, int ixB) {
-//   // pointer to the panel, so we don’t re‑dereference the member every call
-//   auto m = _matrix;
-
-//   for (int y = 0; y < height; y++) {
-//     const uint8_t *row = pix + y * width * channels;
-
-//     // start a run at x=0
-//     int runX = 0;
-//     uint8_t *p0 = (uint8_t *)row;
-//     uint8_t runR = p0[ixR], runG = p0[ixG], runB = p0[ixB];
-//     int runLen = 1;
-
-//     // scan the rest of the row
-//     for (int x = 1; x < width; x++) {
-//       const uint8_t *p = row + x * channels;
-//       uint8_t r = p[ixR], g = p[ixG], b = p[ixB];
-
-//       if (r == runR && g == runG && b == runB) {
-//         // extend current run
-//         runLen++;
-//       } else {
-//         // flush previous run
-//         m->drawFastHLine(runX, y, runLen, runR, runG, runB);
-
-//         // start new run
-//         runX = x;
-//         runLen = 1;
-//         runR = r;
-//         runG = g;
-//         runB = b;
-//       }
-//     }
-//     // flush the last run on this row
-//     m->drawFastHLine(runX, y, runLen, runR, runG, runB);
-//   }
-
-//   // now show the freshly‑drawn back‑buffer in one go
-//   m->flipDMABuffer();
-// }
-
-void display_clear() { _matrix->fillScreenRGB888(0, 0, 0); }
+}
+
+// The palette timings compare the old two pass path (palette over a copy
+// of the frame, then draw) with the fused pipeline
+void display_benchmark(const uint8_t *pix, int width, int height,
+                       int iterations) {
+  if (!pix || iterations <= 0) return;
+  const size_t npix = (size_t)width * height;
+  const gfx_palette_q_t *q = gfx_palette_q(PALETTE_NIGHT);
+  uint8_t *copy = (uint8_t *)malloc(npix * 4);
+  if (!copy) {
+    ESP_LOGE(TAG, "bench: no memory");
+    return;
+  }
+
+  int64_t t0 = esp_timer_get_time();
+  for (int i = 0; i < iterations; i++) {
+    draw_pixels(pix, width, height, 4, 0, 1, 2);
+  }
+  int64_t t1 = esp_timer_get_time();
+  for (int i = 0; i < iterations; i++) {
+    draw_runs(pix, width, height, 4, 0, 1, 2, NULL);
+  }
+  int64_t t2 = esp_timer_get_time();
+  for (int i = 0; i < iterations; i++) {
+    memcpy(copy, pix, npix * 4);
+    gfx_palette_apply_q(copy, npix, q);
+    draw_runs(copy, width, height, 4, 0, 1, 2, NULL);
+  }
+  int64_t t3 = esp_timer_get_time();
+  for (int i = 0; i < iterations; i++) {
+    memcpy(copy, pix, npix * 4);
+    draw_runs(copy, width, height, 4, 0, 1, 2, q);
+  }
+  int64_t t4 = esp_timer_get_time();
+  free(copy);
+  // We scribbled over the back buffer
+  _row_hash_valid[_front ^ 1] = false;
+
+  ESP_LOGI(TAG, "bench %dx%d: per-pixel %lld us, spans %lld us (%d iters)",
+           width, height, (long long)(t1 - t0) / iterations,
+           (long long)(t2 - t1) / iterations, iterations);
+  ESP_LOGI(TAG, "bench palette: two pass %lld us, fused %lld us",
+           (long long)(t3 - t2) / iterations,
+           (long long)(t4 - t3) / iterations);
+}
+#endif
+
+void display_clear() {
+  _matrix->fillScreenRGB888(0, 0, 0);
+  invalidate_rows();
+}
@@ -3,10 +3,16 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "gfx_palette.h"
+
 #define DISPLAY_MAX_BRIGHTNESS 100
 #define DISPLAY_MIN_BRIGHTNESS 1
 #define DISPLAY_DEFAULT_BRIGHTNESS 20
 
+// Panel geometry
+#define DISPLAY_WIDTH 64
+#define DISPLAY_HEIGHT 32
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,16 +20,38 @@ extern "C" {
 int display_initialize();
 
 void display_shutdown();
+// Clears the panel, so once gfx runs only its present stage calls this, see
+// gfx_set_brightness()
 void display_set_brightness(uint8_t b);
 void toggle_display_night_mode();
 void toggle_display();
 uint8_t get_brightness();
 
+// Draw counters, mostly to see how much the row diffing saves
+typedef struct display_stats {
+  uint32_t frames;   // Frames submitted
+  uint32_t skipped;  // Frames identical to what's shown, no flip
+  uint32_t rows;     // Rows re-encoded into the back buffer
+} display_stats_t;
+
 void display_draw(const uint8_t *pix, int width, int height, int channels,
                   int ixR, int ixG, int ixB);
+// Same as display_draw, but only rows [y0, y1) may differ from the previous
+// frame handed to us. Rows outside that range aren't even looked at.
+// `palette` (NULL for none) is applied while drawing, `pix` is left as is.
+void display_draw_region(const uint8_t *pix, int width, int height,
+                         int channels, int ixR, int ixG, int ixB,
+                         const gfx_palette_q_t *palette, int y0, int y1);
+void display_get_stats(display_stats_t *out);
 
 void display_clear();
 
+#ifdef DISPLAY_BENCHMARK
+// Time the per-pixel and span based draw paths on the same frame
+void display_benchmark(const uint8_t *pix, int width, int height,
+                       int iterations);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,90 @@
+#pragma once
+
+// Pixel kernels feeding the HUB75 DMA buffers.
+// Kept free of ESP-IDF / driver includes so they build on the host too.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "display.h"
+#include "gfx_palette.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A horizontal span of identically coloured pixels on one row
+typedef struct display_run {
+  uint16_t x;    // First column of the span
+  uint16_t len;  // Number of pixels
+  uint8_t r, g, b;
+} display_run_t;
+
+// Layout of the pixels handed to display_draw*
+typedef struct display_pixfmt {
+  uint8_t channels;
+  uint8_t ix_r, ix_g, ix_b;
+} display_pixfmt_t;
+
+// One row as it goes out to the panel
+typedef struct display_row {
+  uint32_t hash;  // Of the colours below, after any palette
+  int nruns;
+  display_run_t runs[DISPLAY_WIDTH];
+} display_row_t;
+
+// FNV-1a over output pixels. Only used to tell whether a row differs from
+// what a DMA buffer already holds.
+#define DISPLAY_HASH_SEED 2166136261u
+
+static inline uint32_t display_hash_px(uint32_t h, uint8_t r, uint8_t g,
+                                       uint8_t b) {
+  return (h ^ (r | (g << 8) | ((uint32_t)b << 16))) * 16777619u;
+}
+
+// Feed the row its next output pixel: hash it and extend or start a span
+static inline void display_row_push(display_row_t *out, int x, uint8_t r,
+                                    uint8_t g, uint8_t b) {
+  out->hash = display_hash_px(out->hash, r, g, b);
+  if (out->nruns > 0) {
+    display_run_t *run = &out->runs[out->nruns - 1];
+    if (r == run->r && g == run->g && b == run->b) {
+      run->len++;
+      return;
+    }
+  }
+  display_run_t *run = &out->runs[out->nruns++];
+  run->x = (uint16_t)x;
+  run->len = 1;
+  run->r = r;
+  run->g = g;
+  run->b = b;
+}
+
+// Collapse one decoded row into spans of identical colour, so the driver
+// packs each span into its bit-planes once instead of once per pixel. The
+// palette (if any) is applied on the way, the source isn't modified.
+// `width` must not exceed DISPLAY_WIDTH.
+//
+// Fully transparent pixels come out black: the decoder hands us
+// premultiplied rgbA, so their colour channels are already zero.
+//
+// This is the generic version, display.cpp has it specialised per layout.
+static inline void display_row_runs(const uint8_t *row, int width,
+                                    const display_pixfmt_t *fmt,
+                                    const gfx_palette_q_t *q,
+                                    display_row_t *out) {
+  out->hash = DISPLAY_HASH_SEED;
+  out->nruns = 0;
+
+  const uint8_t *p = row;
+  for (int x = 0; x < width; x++, p += fmt->channels) {
+    uint8_t r = p[fmt->ix_r], g = p[fmt->ix_g], b = p[fmt->ix_b];
+    if (q) gfx_palette_px_q(q, &r, &g, &b);
+    display_row_push(out, x, r, g, b);
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif
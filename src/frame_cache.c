@@ -0,0 +1,102 @@
+#include "frame_cache.h"
+
+#include <esp_log.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mem_pool.h"
+
+static const char *TAG = "frame_cache";
+
+bool frame_cache_init(frame_cache_t *c, uint32_t w, uint32_t h,
+                      uint32_t frames) {
+  memset(c, 0, sizeof(*c));
+  if (w == 0 || h == 0 || frames == 0) return false;
+
+  const size_t npix = (size_t)w * h;
+  frame_cache_fmt_t fmt = FRAME_CACHE_RGBA8888;
+  size_t frame_bytes = npix * 4;
+  if (frame_bytes * frames > FRAME_CACHE_BUDGET) {
+#if FRAME_CACHE_ALLOW_RGB565
+    fmt = FRAME_CACHE_RGB565;
+    frame_bytes = npix * 2;
+#endif
+    if (frame_bytes * frames > FRAME_CACHE_BUDGET) {
+      ESP_LOGI(TAG, "%lu frames of %lux%lu exceed budget (%d), not caching",
+               frames, w, h, FRAME_CACHE_BUDGET);
+      return false;
+    }
+  }
+
+  c->data = mem_pool_alloc(frame_bytes * frames);
+  c->frames = mem_pool_calloc(frames, sizeof(*c->frames));
+  if (fmt == FRAME_CACHE_RGB565) {
+    c->scratch = mem_pool_alloc(npix * 4);
+  }
+  if (!c->data || !c->frames || (fmt == FRAME_CACHE_RGB565 && !c->scratch)) {
+    ESP_LOGW(TAG, "could not allocate %zu bytes, not caching",
+             frame_bytes * frames);
+    frame_cache_free(c);
+    return false;
+  }
+
+  c->frame_count = frames;
+  c->width = w;
+  c->height = h;
+  c->frame_bytes = frame_bytes;
+  c->fmt = fmt;
+  ESP_LOGI(TAG, "caching %lu frames as %s (%zu bytes)", frames,
+           fmt == FRAME_CACHE_RGB565 ? "RGB565" : "RGBA", frame_bytes * frames);
+  return true;
+}
+
+void frame_cache_free(frame_cache_t *c) {
+  mem_pool_free(c->data);
+  mem_pool_free(c->scratch);
+  mem_pool_free(c->frames);
+  memset(c, 0, sizeof(*c));
+}
+
+void frame_cache_store(frame_cache_t *c, uint32_t idx, const uint8_t *rgba,
+                       const frame_cache_entry_t *entry) {
+  if (!c->data || idx != c->filled || idx >= c->frame_count) return;
+
+  uint8_t *dst = c->data + idx * c->frame_bytes;
+  if (c->fmt == FRAME_CACHE_RGBA8888) {
+    memcpy(dst, rgba, c->frame_bytes);
+  } else {
+    const size_t npix = (size_t)c->width * c->height;
+    uint16_t *out = (uint16_t *)dst;
+    for (size_t i = 0; i < npix; i++, rgba += 4) {
+      out[i] = ((rgba[0] & 0xF8) << 8) | ((rgba[1] & 0xFC) << 3) |
+               (rgba[2] >> 3);
+    }
+  }
+  c->frames[idx] = *entry;
+  c->filled++;
+}
+
+const uint8_t *frame_cache_load(frame_cache_t *c, uint32_t idx,
+                                frame_cache_entry_t *entry) {
+  if (!c->data || idx >= c->filled) return NULL;
+
+  *entry = c->frames[idx];
+  const uint8_t *src = c->data + idx * c->frame_bytes;
+  if (c->fmt == FRAME_CACHE_RGBA8888) {
+    return src;
+  }
+
+  // Expand back to RGBA, replicating the top bits into the bottom ones
+  const size_t npix = (size_t)c->width * c->height;
+  const uint16_t *in = (const uint16_t *)src;
+  uint8_t *p = c->scratch;
+  for (size_t i = 0; i < npix; i++, p += 4) {
+    uint16_t v = in[i];
+    uint8_t r = (v >> 11) & 0x1F, g = (v >> 5) & 0x3F, b = v & 0x1F;
+    p[0] = (r << 3) | (r >> 2);
+    p[1] = (g << 2) | (g >> 4);
+    p[2] = (b << 3) | (b >> 2);
+    p[3] = 0xFF;
+  }
+  return c->scratch;
+}
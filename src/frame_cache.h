@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+
+// Bytes we're willing to spend on decoded frames of the active image
+#ifndef FRAME_CACHE_BUDGET
+#ifdef CONFIG_SPIRAM
+#define FRAME_CACHE_BUDGET (1024 * 1024)
+#else
+#define FRAME_CACHE_BUDGET (48 * 1024)
+#endif
+#endif
+
+// Fall back to RGB565 frames when RGBA doesn't fit the budget
+#ifndef FRAME_CACHE_ALLOW_RGB565
+#define FRAME_CACHE_ALLOW_RGB565 1
+#endif
+
+typedef enum {
+  FRAME_CACHE_RGBA8888 = 0,
+  FRAME_CACHE_RGB565,
+} frame_cache_fmt_t;
+
+// What we need to replay a frame besides its pixels
+typedef struct frame_cache_entry {
+  uint16_t delay_ms;            // Time until the next frame
+  uint16_t dirty_y0, dirty_y1;  // Rows changed from the previous frame
+} frame_cache_entry_t;
+
+// Composited frames of one loop of an animation, as decoded. The palette is
+// applied on the way to the panel so it never invalidates them.
+typedef struct frame_cache {
+  uint8_t *data;                // frame_count * frame_bytes
+  uint8_t *scratch;             // RGBA expansion of RGB565 frames
+  frame_cache_entry_t *frames;  // Per frame replay info
+  uint32_t frame_count;
+  uint32_t filled;  // Frames stored so far, in order
+  uint16_t width, height;
+  size_t frame_bytes;
+  frame_cache_fmt_t fmt;
+} frame_cache_t;
+
+// Reserve room for `frames` frames of w x h. Returns false (and leaves the
+// cache empty) if they don't fit the budget or the heap.
+bool frame_cache_init(frame_cache_t *c, uint32_t w, uint32_t h,
+                      uint32_t frames);
+void frame_cache_free(frame_cache_t *c);
+
+static inline bool frame_cache_ready(const frame_cache_t *c) {
+  return c->data && c->filled == c->frame_count;
+}
+
+// Store frame `idx` (0 based) of a loop. Frames must arrive in order
+// starting from 0, anything else is ignored.
+void frame_cache_store(frame_cache_t *c, uint32_t idx, const uint8_t *rgba,
+                       const frame_cache_entry_t *entry);
+
+// RGBA pixels of frame `idx`, valid until the next load
+const uint8_t *frame_cache_load(frame_cache_t *c, uint32_t idx,
+                                frame_cache_entry_t *entry);
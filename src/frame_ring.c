@@ -0,0 +1,32 @@
+#include "frame_ring.h"
+
+#include <esp_log.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "frame_ring";
+
+int frame_ring_init(frame_ring_t *r) {
+  memset(r, 0, sizeof(*r));
+  for (int i = 0; i < FRAME_RING_SLOTS; i++) {
+    r->slots[i].pixels = malloc(FRAME_RING_FRAME_BYTES);
+    if (!r->slots[i].pixels) {
+      ESP_LOGE(TAG, "could not allocate frame %d (%d bytes)", i,
+               FRAME_RING_FRAME_BYTES);
+      frame_ring_free(r);
+      return 1;
+    }
+  }
+  atomic_init(&r->head, 0);
+  atomic_init(&r->tail, 0);
+  ESP_LOGI(TAG, "%d frames of %d bytes", FRAME_RING_SLOTS,
+           FRAME_RING_FRAME_BYTES);
+  return 0;
+}
+
+void frame_ring_free(frame_ring_t *r) {
+  for (int i = 0; i < FRAME_RING_SLOTS; i++) {
+    free(r->slots[i].pixels);
+    r->slots[i].pixels = NULL;
+  }
+}
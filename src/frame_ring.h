@@ -0,0 +1,84 @@
+#pragma once
+
+// Single producer / single consumer ring of decoded frames, handing frames
+// from the decode worker to the present task without locks.
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "display.h"
+#include "sdkconfig.h"
+
+// Frames decoded ahead of the one on screen
+#ifndef FRAME_RING_SLOTS
+#ifdef CONFIG_SPIRAM
+#define FRAME_RING_SLOTS 3
+#else
+#define FRAME_RING_SLOTS 2
+#endif
+#endif
+
+// Frames are cropped to the panel, anything beyond it is never shown
+#define FRAME_RING_FRAME_BYTES (DISPLAY_WIDTH * DISPLAY_HEIGHT * 4)
+
+typedef struct frame_ring_slot {
+  uint8_t *pixels;  // rgbA, width * height, tightly packed
+  uint16_t width, height;
+  uint32_t pts_ms;              // Start on the image's timeline
+  uint16_t delay_ms;            // Time until the next frame
+  uint16_t dirty_y0, dirty_y1;  // Rows changed from the previous frame
+  uint32_t frame_idx;           // 1 based within the loop
+  uint32_t loop_count;          // Loops completed before this frame
+  uint32_t frame_count;         // Frames per loop
+  uint32_t epoch;               // Which image this frame belongs to
+  uint32_t decode_us;           // Time the worker spent on it
+  bool end;                     // No pixels, the image is done at pts
+  bool error;                   // Set with end if it never decoded
+  bool still;                   // Only frame of the image, held while shown
+  bool primed;                  // Decoded by the standby ahead of the switch
+} frame_ring_slot_t;
+
+typedef struct frame_ring {
+  frame_ring_slot_t slots[FRAME_RING_SLOTS];
+  atomic_uint head;  // Next slot to fill, only the producer moves it
+  atomic_uint tail;  // Next slot to show, only the consumer moves it
+} frame_ring_t;
+
+// Allocate the frame buffers up front, returns 0 on success
+int frame_ring_init(frame_ring_t *r);
+void frame_ring_free(frame_ring_t *r);
+
+// Producer: slot to decode into, NULL while the ring is full
+static inline frame_ring_slot_t *frame_ring_write_slot(frame_ring_t *r) {
+  unsigned head = atomic_load_explicit(&r->head, memory_order_relaxed);
+  unsigned tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+  if (head - tail >= FRAME_RING_SLOTS) return NULL;
+  return &r->slots[head % FRAME_RING_SLOTS];
+}
+
+// Producer: publish the slot from frame_ring_write_slot
+static inline void frame_ring_push(frame_ring_t *r) {
+  unsigned head = atomic_load_explicit(&r->head, memory_order_relaxed);
+  atomic_store_explicit(&r->head, head + 1, memory_order_release);
+}
+
+// Consumer: oldest decoded frame, NULL while the ring is empty
+static inline frame_ring_slot_t *frame_ring_peek(frame_ring_t *r) {
+  unsigned tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+  unsigned head = atomic_load_explicit(&r->head, memory_order_acquire);
+  if (head == tail) return NULL;
+  return &r->slots[tail % FRAME_RING_SLOTS];
+}
+
+// Consumer: number of decoded frames waiting
+static inline unsigned frame_ring_count(frame_ring_t *r) {
+  unsigned tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+  return atomic_load_explicit(&r->head, memory_order_acquire) - tail;
+}
+
+// Consumer: hand the peeked slot back to the producer
+static inline void frame_ring_pop(frame_ring_t *r) {
+  unsigned tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+  atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+}
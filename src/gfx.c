@@ -1,17 +1,24 @@
 #include "gfx.h"
 
-#include <assets.h>
+#include <esp_heap_caps.h>
 #include <esp_log.h>
+#include <esp_rom_crc.h>
 #include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/event_groups.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
+#include <stdatomic.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <webp/demux.h>
 
+#include "asset_store.h"
 #include "display.h"
+#include "frame_cache.h"
+#include "frame_ring.h"
+#include "mem_pool.h"
 #include "ota_server.h"  // don't starve
 #include "util.h"
 
@@ -21,25 +28,79 @@ static const char *TAG = "gfx";
 #define GFX_TASK_PRIO 2
 #define GFX_TASK_STACK_SIZE 4092
 
-#define DRAW_SLOT 0
-#define WEBP_LIST_MAX 4
-
-struct gfx_state {
-  TaskHandle_t task;
-  SemaphoreHandle_t mutex;
-  webp_item_t *slots[WEBP_LIST_MAX + 1];  // [0]=draw, [1..4]=apps
-  uint32_t counter;
-  uint8_t last_slot;
-  QueueHandle_t cmd_queue;
+// The decode worker runs ahead on the other core
+#define GFX_DECODE_CORE 0
+#define GFX_DECODE_PRIO 2
+#define GFX_DECODE_STACK_SIZE 4092
+
+// Shortest time a frame stays up, shorter (or zero) durations are raised
+#define GFX_MIN_FRAME_MS 10
+// Give up catching up and restart the timeline this far behind
+#define GFX_RESYNC_MS 1000
+// Late frames skipped in a row before one is drawn anyway
+#define GFX_MAX_SKIP 4
+// Lateness histogram, 1 ms buckets with the last one catching the rest
+#define GFX_LATE_BUCKETS 64
+
+#define DRAW_SLOT 0  // Boot image, never part of the rotation
+
+// The next app's first frame is decoded this long before its turn, so the
+// switch is a buffer flip. Costs a second decoder meanwhile, 0 turns it off.
+#ifndef GFX_STANDBY_LEAD_MS
+#ifdef CONFIG_SPIRAM
+#define GFX_STANDBY_LEAD_MS 1500
+#else
+#define GFX_STANDBY_LEAD_MS 0  // Internal RAM has room for one decoder
+#endif
+#endif
+
+// Bytes of app images the rotation keeps, past that the least recently
+// fetched ones go. Also capped to a quarter of the PSRAM free at boot.
+#ifndef GFX_ROTATION_BUDGET
+#ifdef CONFIG_SPIRAM
+#define GFX_ROTATION_BUDGET (1024 * 1024)
+#else
+#define GFX_ROTATION_BUDGET 0  // No room to keep apps around, one at a time
+#endif
+#endif
+// Typical app image, sizes the slot table from the budget
+#define GFX_APP_BYTES (24 * 1024)
+// Most app slots there can be, whatever the budget
+#ifndef GFX_ROTATION_MAX
+#define GFX_ROTATION_MAX 24
+#endif
+
+// Tasks that read slot items without the mutex, each pins one at a time.
+// The decoder validates against the present pin, keep PRESENT first.
+enum {
+  GFX_READER_PRESENT,
+  GFX_READER_DECODE,
+  GFX_READER_STANDBY,  // Decoder, the app coming up next
+  GFX_READER_PARKED,   // Decoder, the app an alert interrupted
+  GFX_READERS
 };
+// Pinned items are all that can be waiting, so this never fills up
+#define GFX_RETIRE_MAX (GFX_READERS + 1)
 
 typedef enum {
   CMD_DRAW_SLOT,
   CMD_DRAW_BUFFER,
   CMD_CLEAR,
-  CMD_SET_PALETTE
+  CMD_SET_PALETTE,
+  CMD_SET_BRIGHTNESS,
+  CMD_PREVIEW
 } gfx_cmd_type_t;
 
+// Who's asking, system screens (OTA progress, clear) beat app content
+typedef enum { GFX_PRIO_CONTENT, GFX_PRIO_SYSTEM, GFX_PRIOS } gfx_prio_t;
+
+// Commands that change how the panel looks rather than what's on it
+typedef enum {
+  GFX_SETTING_PALETTE,
+  GFX_SETTING_BRIGHTNESS,
+  GFX_SETTINGS
+} gfx_setting_t;
+
 typedef struct {
   gfx_cmd_type_t type;
   uint8_t slot;  // which slot this command targets (if applicable)
@@ -48,15 +109,89 @@ typedef struct {
     struct {
       const void *buf;
       size_t len;
+      uint32_t secs;  // Alert, resume what it interrupted after. 0 holds.
     } draw_buffer;
 
     struct {
       gfx_palette_t palette;
     } set_palette;
-    // CLEAR has no extra data
+
+    struct {
+      uint8_t pct;
+    } set_brightness;
+    // CLEAR and PREVIEW have no extra data, see gfx_state.preview
   } u;
 } gfx_cmd_t;
 
+// Latest command of each kind, a newer one replaces what's pending. Only
+// one image can be up, so the highest priority pending show wins and the
+// rest are dropped. Settings only need their latest value applied.
+typedef struct {
+  gfx_cmd_t show[GFX_PRIOS];
+  gfx_cmd_t setting[GFX_SETTINGS];
+  int64_t show_us[GFX_PRIOS], setting_us[GFX_SETTINGS];  // Posted at
+  bool show_pending[GFX_PRIOS], setting_pending[GFX_SETTINGS];
+} gfx_mailbox_t;
+
+struct gfx_state {
+  TaskHandle_t task;         // Present stage
+  TaskHandle_t decode_task;  // Decode stage
+  SemaphoreHandle_t mutex;   // Serialises slot writers, readers never take it
+  _Atomic(webp_item_t *) *slots;  // [0]=draw, [1..nslots-1]=apps
+  uint8_t nslots;                 // Sized from the rotation budget at init
+  _Atomic(webp_item_t *) pinned[GFX_READERS];  // Items readers are using
+  webp_item_t *retired[GFX_RETIRE_MAX];  // Unpublished, waiting on readers
+  uint8_t nretired;
+  size_t rotation_budget;  // Bytes, see GFX_ROTATION_BUDGET
+  atomic_uint fetch_seq;   // Stamps items for LRU eviction
+  uint32_t last_crc;       // Last image the rotation was given, mutex held
+  size_t last_len;
+  atomic_bool rotating;    // Present stage is cycling the app slots
+#ifdef GFX_SLOT_STRESS
+  atomic_int items;  // Live webp items
+#endif
+  uint32_t counter;
+  uint8_t last_slot;      // Last slot drawn, what a preview gives way to
+  atomic_bool previewing;  // A preview is up or coming, cleared by a draw
+  // Partial images from a download in progress. The writer fills one
+  // while the present stage may copy the other, cmd_lock only guards
+  // which is which.
+  uint8_t *preview[2];
+  uint16_t preview_w[2], preview_h[2];
+  int8_t preview_ready;  // Published and not taken yet, -1 for none
+  int8_t preview_busy;   // Present stage is copying it, -1 for none
+  gfx_mailbox_t mailbox;  // Commands for the present stage
+  portMUX_TYPE cmd_lock;  // Guards mailbox, held for a few copies at most
+  uint64_t cmd_us_total;
+  QueueHandle_t decode_jobs;  // Single entry mailbox for the decode stage
+  frame_ring_t ring;          // Decoded frames, decode -> present
+  atomic_uint standby_slot;   // App the decoder should get ready, 0 for none
+  frame_ring_slot_t standby;  // Its first frame, decode stage only
+  int64_t switch_us;          // Present stage: new image asked for at
+  bool switching;             // ... and not on screen yet
+  uint64_t switch_us_total;
+  // Untransformed copy of the frame on the panel, present stage only
+  uint8_t *shown;
+  uint16_t shown_w, shown_h;
+  uint32_t shown_epoch;  // Image it belongs to, 0 for none
+  esp_timer_handle_t frame_timer;  // Wakes the present stage
+  gfx_stats_t stats;
+  uint64_t decode_us_total, present_us_total;
+  uint32_t late_hist[GFX_LATE_BUCKETS];
+};
+
+// What the decode stage should be working on
+typedef struct {
+  webp_item_t *item;   // buf's owner, NULL for static buffers
+  const uint8_t *buf;  // NULL to stop
+  size_t len;
+  uint32_t epoch;  // Stamped on every frame decoded from buf
+  bool park;       // Keep the decoder of the image this one interrupts
+  bool hold;       // Leave the parked decoder be
+  bool resume;     // Carry on with the parked decoder if it's item's
+  uint32_t resume_idx, resume_loop, resume_pts_ms;  // Next frame to show
+} gfx_decode_job_t;
+
 static struct gfx_state *_state = NULL;
 
 // minimal WebP decoder state + API
@@ -66,19 +201,43 @@ typedef struct {
   uint32_t last_ts;
   uint32_t frame_idx;   // which frame in current loop
   uint32_t loop_count;  // how many loops completed
+  // Canvas rows [dirty_y0, dirty_y1) changed by the last frame
+  int dirty_y0, dirty_y1;
+  int prev_y0, prev_y1;  // Previous frame's rect rows
+  bool prev_dispose;     // Previous frame disposes to background
+  // Frames of the first loop, replayed instead of decoding again
+  frame_cache_t cache;
+  bool replaying;
 } webp_decoder_t;
 
 // private
 static void gfx_loop(void *arg);
+static void gfx_decode_loop(void *arg);
+static void gfx_frame_timer_cb(void *arg);
 // static draw_result_t draw_webp(const uint8_t *buf, size_t len);
 uint8_t gfx_activate_slot(uint8_t k);
+static bool gfx_item_pinned(const webp_item_t *item);
+static inline gfx_palette_t gfx_item_palette(const webp_item_t *item);
+static uint8_t *gfx_item_unwrap(webp_item_t *item);
+static webp_item_t *gfx_item_wrap(uint8_t *buf, size_t len,
+                                  const webp_meta_t *meta);
+static void gfx_retire(webp_item_t *item);
+static void gfx_swap_locked(uint8_t slot, webp_item_t *item,
+                            const webp_meta_t *meta);
+static bool gfx_slot_writable(uint8_t slot, const uint8_t *webp, size_t len);
 static bool validate_webp_signature(const uint8_t *data, size_t len);
 static inline int webp_decoder_init(webp_decoder_t *d, const uint8_t *buf,
-                                    size_t len);
+                                    size_t len, bool cache);
+static inline void webp_decoder_init_cache(webp_decoder_t *d);
 static inline bool webp_decoder_next_frame(webp_decoder_t *d,
                                            uint8_t **out_pixels,
-                                           int *out_delay_ms);
+                                           int *out_delay_ms,
+                                           bool *out_cached);
+static inline void webp_decoder_cache_frame(webp_decoder_t *d,
+                                            const uint8_t *pixels,
+                                            int delay_ms);
 static inline void webp_decoder_deinit(webp_decoder_t *d);
+static void webp_decoder_dirty_rows(webp_decoder_t *d);
 
 int gfx_initialize(const void *boot_webp, size_t boot_len) {
   // Only initialize once
@@ -87,9 +246,6 @@ int gfx_initialize(const void *boot_webp, size_t boot_len) {
     return 1;
   }
 
-  size_t heapl = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
-  ESP_LOGI(TAG, "Allocating buffer of %zu on heap of %zu", boot_len, heapl);
-
   // Initialize state
   _state = calloc(1, sizeof(struct gfx_state));
   _state->mutex = xSemaphoreCreateMutex();
@@ -98,41 +254,118 @@ int gfx_initialize(const void *boot_webp, size_t boot_len) {
     return 1;
   }
 
-  _state->cmd_queue = xQueueCreate(8, sizeof(gfx_cmd_t));
-  if (!_state->cmd_queue) {
-    ESP_LOGE(TAG, "failed to create gfx command queue");
+  _state->cmd_lock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+
+  _state->decode_jobs = xQueueCreate(1, sizeof(gfx_decode_job_t));
+  if (!_state->decode_jobs) {
+    ESP_LOGE(TAG, "failed to create gfx decode queue");
     return 1;
   }
 
+  if (frame_ring_init(&_state->ring)) {
+    return 1;
+  }
+  _state->shown = malloc(FRAME_RING_FRAME_BYTES);
+  if (!_state->shown) {
+    ESP_LOGE(TAG, "failed to allocate the shown frame");
+    return 1;
+  }
+  for (int i = 0; i < 2; i++) {
+    _state->preview[i] = malloc(FRAME_RING_FRAME_BYTES);
+    if (!_state->preview[i]) {
+      ESP_LOGE(TAG, "failed to allocate the preview frames");
+      return 1;
+    }
+  }
+  _state->preview_ready = _state->preview_busy = -1;
+  if (GFX_STANDBY_LEAD_MS > 0) {
+    // Without it apps just switch the slow way
+    _state->standby.pixels = malloc(FRAME_RING_FRAME_BYTES);
+  }
+
+  const esp_timer_create_args_t timer_args = {
+      .callback = gfx_frame_timer_cb,
+      .name = "gfx_frame",
+  };
+  if (esp_timer_create(&timer_args, &_state->frame_timer) != ESP_OK) {
+    ESP_LOGE(TAG, "failed to create gfx frame timer");
+    return 1;
+  }
+
+  // Size the slot table from the memory we can spend on apps, at least
+  // one app slot
+#ifdef CONFIG_SPIRAM
+  _state->rotation_budget =
+      MIN(GFX_ROTATION_BUDGET, heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 4);
+#else
+  _state->rotation_budget = GFX_ROTATION_BUDGET;
+#endif
+  size_t apps = MIN(_state->rotation_budget / GFX_APP_BYTES, GFX_ROTATION_MAX);
+  _state->nslots = 1 + MAX(apps, 1);
+  _state->slots = calloc(_state->nslots, sizeof(*_state->slots));
+  if (!_state->slots) {
+    ESP_LOGE(TAG, "could not allocate %d slots", _state->nslots);
+    return 1;
+  }
+  ESP_LOGI(TAG, "%d app slots, %zu bytes budget", _state->nslots - 1,
+           _state->rotation_budget);
+
   // zero out all slots
-  for (uint8_t i = 0; i < WEBP_LIST_MAX; ++i) {
-    _state->slots[i] = NULL;
+  for (uint8_t i = 0; i < _state->nslots; ++i) {
+    atomic_init(&_state->slots[i], NULL);
+  }
+  for (int r = 0; r < GFX_READERS; r++) {
+    atomic_init(&_state->pinned[r], NULL);
   }
 
   // ─── pre‐populate slot 0 with the boot WebP ───────────────────
-  struct webp_item *boot = malloc(sizeof *boot);
-  boot->buf = malloc(boot_len);
-  memcpy(boot->buf, boot_webp, boot_len);
-
-  boot->len = boot_len;
-  boot->size = boot_len;
-  boot->meta =
-      (webp_meta_t){.dwell_secs = 0, .palette_mode = 0};  // replay forever
-  _state->slots[DRAW_SLOT] = boot;
+  // Borrowed straight from flash, no copy. Without one the panel stays
+  // dark until the first fetch.
+  if (boot_webp) {
+    const webp_meta_t boot_meta = {.dwell_secs = 0,
+                                   .palette_mode = 0};  // replay forever
+    struct webp_item *boot =
+        gfx_item_wrap((uint8_t *)boot_webp, boot_len, &boot_meta);
+    if (!boot) {
+      ESP_LOGE(TAG, "could not allocate boot slot");
+      return 1;
+    }
+    boot->borrowed = true;
+    atomic_store(&_state->slots[DRAW_SLOT], boot);
+  }
 
   // Initialize the display
   if (display_initialize()) {
     return 1;
   }
 
+#ifdef GFX_PALETTE_BENCHMARK
+  gfx_palette_benchmark();
+#endif
+
+  // Decode stage first, the present stage hands it work straight away
+  BaseType_t ret =
+      xTaskCreatePinnedToCore(gfx_decode_loop,        // pvTaskCode
+                              "gfx_decode",           // pcName
+                              GFX_DECODE_STACK_SIZE,  // usStackDepth
+                              NULL,                   // pvParameters
+                              GFX_DECODE_PRIO,        // uxPriority
+                              &_state->decode_task,   // pxCreatedTask
+                              GFX_DECODE_CORE         // xCoreID
+      );
+  if (ret != pdPASS) {
+    ESP_LOGE(TAG, "Could not create gfx decode task");
+    return 1;
+  }
+
   // Launch the graphics loop in separate task
-  BaseType_t ret = xTaskCreatePinnedToCore(gfx_loop,             // pvTaskCode
-                                           "gfx_loop",           // pcName
-                                           GFX_TASK_STACK_SIZE,  // usStackDepth
-                                           NULL,                 // pvParameters
-                                           GFX_TASK_PRIO,        // uxPriority
-                                           &_state->task,  // pxCreatedTask
-                                           GFX_TASK_CORE   // xCoreID
+  ret = xTaskCreatePinnedToCore(gfx_loop,             // pvTaskCode
+                                "gfx_loop",           // pcName
+                                GFX_TASK_STACK_SIZE,  // usStackDepth
+                                NULL,                 // pvParameters
+                                GFX_TASK_PRIO,        // uxPriority
+                                &_state->task,        // pxCreatedTask
+                                GFX_TASK_CORE         // xCoreID
   );
   if (ret != pdPASS) {
     ESP_LOGE(TAG, "Could not create gfx task");
@@ -149,11 +382,12 @@ int gfx_initialize(const void *boot_webp, size_t boot_len) {
 
 // Read only copy of meta for peeks
 bool gfx_get_slot_meta(uint8_t slot, webp_meta_t *out) {
-  if (slot >= WEBP_LIST_MAX || !out) return false;
+  if (slot >= _state->nslots || !out) return false;
 
   if (xSemaphoreTake(_state->mutex, portMAX_DELAY) == pdTRUE) {
-    if (_state->slots[slot]) {
-      *out = _state->slots[slot]->meta;  // struct copy
+    webp_item_t *item = atomic_load(&_state->slots[slot]);
+    if (item) {
+      *out = item->meta;  // struct copy
       xSemaphoreGive(_state->mutex);
       return true;
     }
@@ -162,67 +396,205 @@ bool gfx_get_slot_meta(uint8_t slot, webp_meta_t *out) {
   return false;
 }
 
-static inline int _send_cmd(const gfx_cmd_t *cmd) {
-  return xQueueSend(_state->cmd_queue, cmd, pdMS_TO_TICKS(100)) == pdTRUE ? 0
-                                                                          : 1;
+// Mailbox entry of a setting command, -1 for shows
+static inline int gfx_cmd_setting(const gfx_cmd_t *cmd) {
+  switch (cmd->type) {
+    case CMD_SET_PALETTE:
+      return GFX_SETTING_PALETTE;
+    case CMD_SET_BRIGHTNESS:
+      return GFX_SETTING_BRIGHTNESS;
+    default:
+      return -1;
+  }
+}
+
+// Post to the mailbox, never blocks. Replaces a pending command of the
+// same kind.
+static int _send_cmd(const gfx_cmd_t *cmd, gfx_prio_t prio) {
+  gfx_mailbox_t *m = &_state->mailbox;
+  gfx_stats_t *s = &_state->stats;
+  const int setting = gfx_cmd_setting(cmd);
+  const int64_t now = esp_timer_get_time();
+
+  taskENTER_CRITICAL(&_state->cmd_lock);
+  bool *pending = setting >= 0 ? &m->setting_pending[setting]
+                               : &m->show_pending[prio];
+  if (*pending) s->cmd_coalesced++;
+  *pending = true;
+  if (setting >= 0) {
+    m->setting[setting] = *cmd;
+    m->setting_us[setting] = now;
+  } else {
+    m->show[prio] = *cmd;
+    m->show_us[prio] = now;
+  }
+  uint32_t depth = 0;
+  for (int k = 0; k < GFX_SETTINGS; k++) depth += m->setting_pending[k];
+  for (int p = 0; p < GFX_PRIOS; p++) depth += m->show_pending[p];
+  s->cmd_depth_max = MAX(s->cmd_depth_max, depth);
+  s->cmd_posted++;
+  taskEXIT_CRITICAL(&_state->cmd_lock);
+
+  xTaskNotifyGive(_state->task);
+  return 0;
+}
+
+static inline bool gfx_cmd_is_alert(const gfx_cmd_t *cmd) {
+  return cmd->type == CMD_DRAW_BUFFER && cmd->u.draw_buffer.secs > 0;
+}
+
+// Present stage: commands to act on in order, superseded ones dropped.
+// Returns how many went into out, at most GFX_CMDS_MAX.
+#define GFX_CMDS_MAX (1 + GFX_SETTINGS)
+static int gfx_take_cmds(gfx_cmd_t out[GFX_CMDS_MAX], bool hold_content) {
+  gfx_mailbox_t *m = &_state->mailbox;
+  gfx_stats_t *s = &_state->stats;
+  const int64_t now = esp_timer_get_time();
+  int n = 0;
+
+  taskENTER_CRITICAL(&_state->cmd_lock);
+  for (int p = GFX_PRIOS - 1; p >= 0; p--) {
+    if (!m->show_pending[p]) continue;
+    // Content waits out an alert rather than being dropped
+    if (p == GFX_PRIO_CONTENT &&
+        (hold_content || (n && gfx_cmd_is_alert(&out[0])))) {
+      break;
+    }
+    m->show_pending[p] = false;
+    if (n) {
+      s->cmd_coalesced++;  // Outranked
+      continue;
+    }
+    out[n++] = m->show[p];
+    const uint32_t us = now - m->show_us[p];
+    _state->cmd_us_total += us;
+    s->cmd_latency_us_max = MAX(s->cmd_latency_us_max, us);
+  }
+  for (int k = 0; k < GFX_SETTINGS; k++) {
+    if (!m->setting_pending[k]) continue;
+    m->setting_pending[k] = false;
+    out[n++] = m->setting[k];
+    const uint32_t us = now - m->setting_us[k];
+    _state->cmd_us_total += us;
+    s->cmd_latency_us_max = MAX(s->cmd_latency_us_max, us);
+  }
+  s->cmd_handled += n;
+  taskEXIT_CRITICAL(&_state->cmd_lock);
+  return n;
 }
 
 int gfx_draw_slot(uint8_t slot) {
   gfx_cmd_t cmd = {.type = CMD_DRAW_SLOT, .slot = slot};
 
-  return _send_cmd(&cmd);
+  return _send_cmd(&cmd, GFX_PRIO_CONTENT);
 }
 
 int gfx_draw_buffer(const void *buf, size_t len) {
   gfx_cmd_t cmd = {.type = CMD_DRAW_BUFFER,
                    .slot = 1,  // unused
                    .u.draw_buffer = {.buf = buf, .len = len}};
-  return _send_cmd(&cmd);
+  return _send_cmd(&cmd, GFX_PRIO_SYSTEM);
+}
+
+int gfx_show_alert(const void *buf, size_t len, uint32_t secs) {
+  if (!buf || !len || !secs) return 1;
+  gfx_cmd_t cmd = {.type = CMD_DRAW_BUFFER,
+                   .u.draw_buffer = {.buf = buf, .len = len, .secs = secs}};
+  return _send_cmd(&cmd, GFX_PRIO_SYSTEM);
+}
+
+// A draw is waiting for an alert to end
+static bool gfx_content_pending(void) {
+  taskENTER_CRITICAL(&_state->cmd_lock);
+  bool pending = _state->mailbox.show_pending[GFX_PRIO_CONTENT];
+  taskEXIT_CRITICAL(&_state->cmd_lock);
+  return pending;
 }
 
+// Writers set the palette, the present stage only reads it. The command
+// lets it redraw a still it's holding.
 int gfx_set_palette(uint8_t slot, gfx_palette_t palette) {
+  if (slot >= _state->nslots) return 1;
+  xSemaphoreTake(_state->mutex, portMAX_DELAY);
+  webp_item_t *item = atomic_load(&_state->slots[slot]);
+  if (item) {
+    __atomic_store_n(&item->meta.palette_mode, palette, __ATOMIC_RELAXED);
+  }
+  xSemaphoreGive(_state->mutex);
+  if (!item) return 1;
+
   gfx_cmd_t cmd = {.type = CMD_SET_PALETTE,
                    .slot = slot,
                    .u.set_palette = {.palette = palette}};
-  return _send_cmd(&cmd);
+  return _send_cmd(&cmd, GFX_PRIO_CONTENT);
 }
 
 int gfx_clear(void) {
   gfx_cmd_t cmd = {.type = CMD_CLEAR};
-  return _send_cmd(&cmd);
+  return _send_cmd(&cmd, GFX_PRIO_SYSTEM);
+}
+
+int gfx_set_brightness(uint8_t pct) {
+  // Nothing draws yet, the panel is ours
+  if (!_state || !_state->task) {
+    display_set_brightness(pct);
+    return 0;
+  }
+  gfx_cmd_t cmd = {.type = CMD_SET_BRIGHTNESS,
+                   .u.set_brightness = {.pct = MIN(pct, 100)}};
+  return _send_cmd(&cmd, GFX_PRIO_CONTENT);
+}
+
+int gfx_show_preview(const uint8_t *rgba, uint16_t width, uint16_t height) {
+  // A rotating app keeps its turn, the download waits for the next one
+  if (atomic_load(&_state->rotating)) return 1;
+  if (!rgba || !width || !height || width > DISPLAY_WIDTH ||
+      height > DISPLAY_HEIGHT) {
+    return 1;
+  }
+  // Fill the canvas the present stage isn't copying. If it's the one
+  // waiting to be taken, take it back first, this one replaces it.
+  taskENTER_CRITICAL(&_state->cmd_lock);
+  const int8_t w = _state->preview_busy == 0 ? 1 : 0;
+  if (_state->preview_ready == w) _state->preview_ready = -1;
+  taskEXIT_CRITICAL(&_state->cmd_lock);
+  memcpy(_state->preview[w], rgba, (size_t)width * height * 4);
+  _state->preview_w[w] = width;
+  _state->preview_h[w] = height;
+  taskENTER_CRITICAL(&_state->cmd_lock);
+  _state->preview_ready = w;
+  taskEXIT_CRITICAL(&_state->cmd_lock);
+  atomic_store(&_state->previewing, true);
+
+  gfx_cmd_t cmd = {.type = CMD_PREVIEW};
+  return _send_cmd(&cmd, GFX_PRIO_CONTENT);
+}
+
+void gfx_cancel_preview(void) {
+  if (!atomic_exchange(&_state->previewing, false)) return;
+  gfx_draw_slot(__atomic_load_n(&_state->last_slot, __ATOMIC_RELAXED));
 }
 
 // Draw our OTA progress in batches
 int gfx_show_ota(uint8_t step) {
-  const void *buf = NULL;
-  size_t len = 0;
-
   switch (step) {
     case 0:
-      buf = ASSET_OTA_PROG_0_WEBP;
-      len = ASSET_OTA_PROG_0_LEN;
-      break;
     case 25:
-      buf = ASSET_OTA_PROG_25_WEBP;
-      len = ASSET_OTA_PROG_25_LEN;
-      break;
     case 50:
-      buf = ASSET_OTA_PROG_50_WEBP;
-      len = ASSET_OTA_PROG_50_LEN;
-      break;
     case 75:
-      buf = ASSET_OTA_PROG_75_WEBP;
-      len = ASSET_OTA_PROG_75_LEN;
-      break;
     case 100:
-      buf = ASSET_OTA_PROG_100_WEBP;
-      len = ASSET_OTA_PROG_100_LEN;
       break;
     default:
       ESP_LOGW(TAG, "Unknown OTA step %d", step);
       return -1;
   }
 
+  char name[16];
+  size_t len = 0;
+  snprintf(name, sizeof(name), "ota_prog_%d", step);
+  const uint8_t *buf = asset_store_get(name, &len);
+  if (!buf) return -1;
+
   ESP_LOGI(TAG, "Showing OTA update stage %d", step);
   return gfx_draw_buffer(buf, len);
 }
@@ -238,42 +610,267 @@ void cycle_display_palette(void) {
 
   gfx_palette_t next = (meta.palette_mode + 1) % PALETTE_COUNT;
 
-  gfx_cmd_t cmd = {
-      .type = CMD_SET_PALETTE,
-      .slot = slot,
-      .u.set_palette = {.palette = next},
-  };
-
-  // Send to gfx loop, just like other commands
-  if (xQueueSend(_state->cmd_queue, &cmd, pdMS_TO_TICKS(100)) != pdTRUE) {
+  if (gfx_set_palette(slot, next) != 0) {
     ESP_LOGW(TAG, "cycle_palette: failed to send command");
   }
 }
 
-// Thin wrapper while we refactor
-// Takes a remotely filled buffer, and copies it to our screen queue
-int gfx_update(const void *webp, size_t len, const webp_meta_t *meta) {
-  // We default to slot 1 for now
-  const uint8_t slot = 1;
-  if (gfx_update_slot(slot, webp, len, meta) != 0) {
-    ESP_LOGW(TAG, "failed pushing webp(%zu) to slot %d", len, slot);
-    return 1;
+// Writer side, mutex held: what the rotation holds right now
+typedef struct {
+  size_t bytes;   // Buffer sizes of all app slots
+  uint8_t count;  // Populated app slots
+  uint8_t empty;  // First empty app slot, 0 if none
+  uint8_t lru;    // Least recently fetched app slot, 0 if none
+} gfx_rotation_scan_t;
+
+static void gfx_rotation_scan(gfx_rotation_scan_t *s) {
+  memset(s, 0, sizeof(*s));
+  uint32_t oldest = 0;
+  const uint32_t now = atomic_load(&_state->fetch_seq);
+  for (uint8_t slot = 1; slot < _state->nslots; slot++) {
+    const webp_item_t *item = atomic_load(&_state->slots[slot]);
+    if (!item) {
+      if (!s->empty) s->empty = slot;
+      continue;
+    }
+    s->bytes += item->size;
+    s->count++;
+    if (!s->lru || now - item->fetched > oldest) {
+      s->lru = slot;
+      oldest = now - item->fetched;
+    }
   }
+}
+
+// The next image needs a slot or room made for it, assuming it's a typical
+// one of those already held
+static bool gfx_rotation_needs_room(const gfx_rotation_scan_t *s) {
+  if (!s->empty) return true;
+  return s->count && s->bytes + s->bytes / s->count > _state->rotation_budget;
+}
+
+// Writer side, mutex held
+static void gfx_rotation_evict(uint8_t slot) {
+  webp_item_t *item = atomic_exchange(&_state->slots[slot], NULL);
+  if (!item) return;
+  ESP_LOGI(TAG, "rotation: evicting slot %d (%zu bytes)", slot, item->size);
+  gfx_retire(item);
+}
 
-  // Swap slots[0]⇄slots[1] atomically
-  if (gfx_activate_slot(slot) != 0) {
-    ESP_LOGE(TAG, "gfx_update: could not activate slot %d", slot);
+// Writer side, mutex held: rotation slot holding a render of app, 0 if none
+static uint8_t gfx_rotation_find_app(uint32_t app) {
+  for (uint8_t slot = 1; slot < _state->nslots; slot++) {
+    const webp_item_t *item = atomic_load(&_state->slots[slot]);
+    if (item && item->meta.app_id == app) return slot;
+  }
+  return 0;
+}
+
+// Writer side, mutex held: rotation slot already holding these bytes, 0 if
+// none. The CRC rules out all but true matches, memcmp settles those.
+static uint8_t gfx_rotation_find(const uint8_t *webp, size_t len,
+                                 uint32_t crc) {
+  for (uint8_t slot = 1; slot < _state->nslots; slot++) {
+    const webp_item_t *item = atomic_load(&_state->slots[slot]);
+    if (item && item->crc == crc && item->len == len &&
+        memcmp(item->buf, webp, len) == 0) {
+      return slot;
+    }
+  }
+  return 0;
+}
+
+// Lock held. The app in item was fetched again, dwell as it says this time.
+static void gfx_rotation_touch_locked(webp_item_t *item,
+                                      const webp_meta_t *meta) {
+  item->fetched = atomic_fetch_add(&_state->fetch_seq, 1);
+  if (meta) {
+    __atomic_store_n(&item->meta.dwell_secs, meta->dwell_secs,
+                     __ATOMIC_RELAXED);
+  }
+}
+
+// Adopt webp into the rotation, returns its slot or 0 if it wasn't taken.
+// It replaces an older render of the same app, otherwise least recently
+// fetched apps make way until it fits the budget, or until it's the only
+// one left. Without an app identity it replaces them all. Bytes the
+// rotation already has aren't taken, the slot holding them counts as
+// fetched again and *dup is set.
+static uint8_t gfx_rotation_put(uint8_t *webp, size_t len,
+                                const webp_meta_t *meta, bool *dup) {
+  *dup = false;
+  if (!gfx_slot_writable(1, webp, len)) return 0;
+  const uint32_t crc = esp_rom_crc32_le(0, webp, len);
+
+  xSemaphoreTake(_state->mutex, portMAX_DELAY);
+  _state->last_crc = crc;
+  _state->last_len = len;
+  uint8_t slot = gfx_rotation_find(webp, len, crc);
+  webp_item_t *item = slot ? atomic_load(&_state->slots[slot]) : NULL;
+  gfx_palette_t palette = PALETTE_NORMAL;
+  if (item) {
+    gfx_rotation_touch_locked(item, meta);
+    palette = gfx_item_palette(item);  // item may be retired once we let go
+    _state->stats.dedupe_hits++;
+    _state->stats.dedupe_bytes += len;
+  } else {
+    _state->stats.dedupe_misses++;
+  }
+  xSemaphoreGive(_state->mutex);
+  if (item) {
+    // Palette changes go through gfx_set_palette, a still needs a redraw
+    if (meta && meta->palette_mode != palette) {
+      gfx_set_palette(slot, meta->palette_mode);
+    }
+    *dup = true;
+    return slot;
+  }
+
+  item = gfx_item_wrap(webp, len, meta);
+  if (!item) {
+    ESP_LOGE(TAG, "rotation: alloc failed");
+    return 0;
+  }
+  item->crc = crc;
+
+  gfx_rotation_scan_t s;
+  const uint32_t app = meta ? meta->app_id : 0;
+  xSemaphoreTake(_state->mutex, portMAX_DELAY);
+  slot = app ? gfx_rotation_find_app(app) : 0;
+  if (!app) {
+    // No telling a clock's new minute from another app, keeping the old
+    // bodies would replay stale renders
+    for (uint8_t k = 1; k < _state->nslots; k++) gfx_rotation_evict(k);
+  }
+  if (!slot) {
+    gfx_rotation_scan(&s);
+    while (s.count && s.bytes + item->size > _state->rotation_budget) {
+      gfx_rotation_evict(s.lru);
+      gfx_rotation_scan(&s);
+    }
+    slot = s.empty ? s.empty : s.lru;
+  }
+  gfx_swap_locked(slot, item, meta);
+  // A render bigger than the one it replaced can push others out
+  gfx_rotation_scan(&s);
+  while (s.count > 1 && s.bytes > _state->rotation_budget) {
+    gfx_rotation_evict(s.lru);
+    gfx_rotation_scan(&s);
+  }
+  xSemaphoreGive(_state->mutex);
+  return slot;
+}
+
+// Thin wrapper while we refactor
+// Takes a remotely filled buffer, copies it into the rotation and shows it
+int gfx_update(const void *webp, size_t len, const webp_meta_t *meta) {
+  uint8_t *buf = mem_pool_alloc_bulk(len);
+  if (!buf) {
+    ESP_LOGE(TAG, "gfx_update: alloc(%zu) failed", len);
     return 1;
   }
+  memcpy(buf, webp, len);
+  bool dup;
+  uint8_t slot = gfx_rotation_put(buf, len, meta, &dup);
+  if (!slot || dup) mem_pool_free(buf);
+  if (!slot) return 1;
 
   ESP_LOGI(TAG, "gfx_update: webp (%zu) copied  to slot %d", len, slot);
   // Notify our gfx task to draw this
   return gfx_draw_slot(slot);
 }
 
+int gfx_rotation_take(uint8_t *webp, size_t len, const webp_meta_t *meta) {
+  bool dup;
+  uint8_t slot = gfx_rotation_put(webp, len, meta, &dup);
+  if (!slot) {
+    gfx_cancel_preview();
+    return 1;
+  }
+
+  // A preview of it is up, the real thing replaces it even if unchanged
+  if (atomic_exchange(&_state->previewing, false)) {
+    if (gfx_draw_slot(slot) != 0) {
+      ESP_LOGE(TAG, "rotation: could not draw slot %d", slot);
+    }
+    if (dup) mem_pool_free(webp);
+    return 0;
+  }
+
+  if (dup) {
+    // Nothing to copy or decode, what's playing carries on
+    ESP_LOGI(TAG, "rotation: webp (%zu) unchanged in slot %d (%lu hits, "
+             "%lu misses)", len, slot, _state->stats.dedupe_hits,
+             _state->stats.dedupe_misses);
+    mem_pool_free(webp);
+    return 0;
+  }
+
+  // The slot owns webp from here on. It plays when its turn comes, unless
+  // nothing is rotating yet or it replaced what's on screen (always, with
+  // a single slot), which would otherwise play out its dwell first.
+  ESP_LOGI(TAG, "rotation: webp (%zu) adopted by slot %d", len, slot);
+  const bool draw_now = !atomic_load(&_state->rotating) ||
+                        slot == __atomic_load_n(&_state->last_slot,
+                                                __ATOMIC_RELAXED);
+  if (draw_now && gfx_draw_slot(slot) != 0) {
+    ESP_LOGE(TAG, "rotation: could not draw slot %d", slot);
+  }
+  return 0;
+}
+
+int gfx_rotation_refresh(const webp_meta_t *meta) {
+  xSemaphoreTake(_state->mutex, portMAX_DELAY);
+  // The app's slot, else the last body taken. Its CRC was checked against
+  // the bytes when it went in.
+  uint8_t slot = meta && meta->app_id ? gfx_rotation_find_app(meta->app_id)
+                                      : 0;
+  for (uint8_t k = 1; k < _state->nslots && !slot; k++) {
+    const webp_item_t *it = atomic_load(&_state->slots[k]);
+    if (it && it->crc == _state->last_crc && it->len == _state->last_len) {
+      slot = k;
+    }
+  }
+  webp_item_t *item = slot ? atomic_load(&_state->slots[slot]) : NULL;
+  gfx_palette_t palette = PALETTE_NORMAL;
+  if (item) {
+    gfx_rotation_touch_locked(item, meta);
+    palette = gfx_item_palette(item);  // item may be retired once we let go
+  }
+  xSemaphoreGive(_state->mutex);
+  if (!item) return 1;
+
+  if (meta && meta->palette_mode != palette) {
+    gfx_set_palette(slot, meta->palette_mode);
+  }
+  ESP_LOGI(TAG, "rotation: slot %d not modified, dwell %us", slot,
+           meta ? meta->dwell_secs : 0);
+  return 0;
+}
+
+bool gfx_rotation_full(void) {
+  if (_state->nslots < 3) return false;
+  gfx_rotation_scan_t s;
+  xSemaphoreTake(_state->mutex, portMAX_DELAY);
+  gfx_rotation_scan(&s);
+  xSemaphoreGive(_state->mutex);
+  return gfx_rotation_needs_room(&s);
+}
+
+// Next populated rotation slot after cur, cur itself if it's the only
+// one, 0 if the rotation is empty
+static uint8_t gfx_rotation_next(uint8_t cur) {
+  const uint8_t n = _state->nslots - 1;
+  for (int i = 1; i <= n; i++) {
+    uint8_t slot = 1 + (cur - 1 + i) % n;
+    if (atomic_load(&_state->slots[slot])) return slot;
+  }
+  return 0;
+}
+
 // swap slot k into DRAW_SLOT and wake the render task
 uint8_t gfx_activate_slot(uint8_t k) {
-  if (k <= 0 || k >= WEBP_LIST_MAX) {
+  if (k <= 0 || k >= _state->nslots) {
     ESP_LOGE(TAG, "activate_slot: index %d out of range", k);
     return 1;
   }
@@ -284,10 +881,10 @@ uint8_t gfx_activate_slot(uint8_t k) {
     return 1;
   }
 
-  // pointer swap DRAW_SLOT <--> slot k
-  webp_item_t *tmp = _state->slots[DRAW_SLOT];
-  _state->slots[DRAW_SLOT] = _state->slots[k];
-  _state->slots[k] = tmp;
+  // pointer swap DRAW_SLOT <--> slot k, both stay published throughout
+  webp_item_t *next = atomic_load(&_state->slots[k]);
+  atomic_store(&_state->slots[k],
+               atomic_exchange(&_state->slots[DRAW_SLOT], next));
 
   // Release lock
   if (xSemaphoreGive(_state->mutex) != pdTRUE) {
@@ -300,253 +897,1106 @@ uint8_t gfx_activate_slot(uint8_t k) {
 
 // Free memory of a slot.. Use with care!
 void gfx_free_slot(uint8_t slot) {
-  if (slot <= 0 || slot >= WEBP_LIST_MAX) return;
+  if (slot <= 0 || slot >= _state->nslots) return;
   xSemaphoreTake(_state->mutex, portMAX_DELAY);
-  if (_state->slots[slot]) {
-    free(_state->slots[slot]->buf);
-    free(_state->slots[slot]);
-    _state->slots[slot] = NULL;
-  }
+  gfx_retire(atomic_exchange(&_state->slots[slot], NULL));
   xSemaphoreGive(_state->mutex);
 }
 
 void gfx_shutdown() {
   // TODO: tear down slots[ ], free buffers here
   vTaskDelete(_state->task);
+  vTaskDelete(_state->decode_task);
+  esp_timer_stop(_state->frame_timer);
+  esp_timer_delete(_state->frame_timer);
+  frame_ring_free(&_state->ring);
+  free(_state->shown);
   vSemaphoreDelete(_state->mutex);
+  free(_state->slots);
   free(_state);
   display_shutdown();
 }
 
-// Copy a buffer into the prescribed slot
-// Caller should free buffer
-uint8_t gfx_update_slot(uint8_t slot, const void *webp, size_t len,
-                        const webp_meta_t *meta) {
-  if (slot == DRAW_SLOT || slot >= WEBP_LIST_MAX) {
-    ESP_LOGE(TAG, "update_slot: slot %d is not writable", slot);
+// Reader side: load a slot's item and pin it so writers won't free it.
+// Lock free, only retries if a writer published in between.
+static webp_item_t *gfx_pin_slot(int reader, uint8_t slot) {
+  webp_item_t *item;
+  do {
+    item = atomic_load(&_state->slots[slot]);
+    atomic_store(&_state->pinned[reader], item);
+  } while (item != atomic_load(&_state->slots[slot]));
+  return item;
+}
+
+static inline void gfx_unpin(int reader) {
+  atomic_store(&_state->pinned[reader], NULL);
+}
+
+static bool gfx_item_pinned(const webp_item_t *item) {
+  for (int r = 0; r < GFX_READERS; r++) {
+    if (atomic_load(&_state->pinned[r]) == item) return true;
+  }
+  return false;
+}
+
+static inline gfx_palette_t gfx_item_palette(const webp_item_t *item) {
+  if (!item) return PALETTE_NORMAL;
+  return __atomic_load_n(&item->meta.palette_mode, __ATOMIC_RELAXED);
+}
+
+static webp_item_t *gfx_item_wrap(uint8_t *buf, size_t len,
+                                  const webp_meta_t *meta) {
+  webp_item_t *item = mem_pool_calloc(1, sizeof(*item));
+  if (!item) return NULL;
+#ifdef GFX_SLOT_STRESS
+  atomic_fetch_add(&_state->items, 1);
+#endif
+  item->buf = buf;
+  item->len = len;
+  item->size = MAX(mem_pool_capacity(buf), len);
+  item->fetched = atomic_fetch_add(&_state->fetch_seq, 1);
+  if (meta) item->meta = *meta;
+  return item;
+}
+
+// Free the item but not its buffer, which goes to the caller
+static uint8_t *gfx_item_unwrap(webp_item_t *item) {
+  uint8_t *buf = item->buf;
+  mem_pool_free(item);
+#ifdef GFX_SLOT_STRESS
+  atomic_fetch_sub(&_state->items, 1);
+#endif
+  return buf;
+}
+
+static void gfx_item_free(webp_item_t *item) {
+  bool borrowed = item->borrowed;
+#ifdef GFX_SLOT_STRESS
+  if (!borrowed) memset(item->buf, 0, item->len);  // Late readers fail loudly
+#endif
+  uint8_t *buf = gfx_item_unwrap(item);
+  if (!borrowed) mem_pool_free(buf);
+}
+
+// Writer side, mutex held: free retired items nobody has pinned
+static void gfx_reclaim(void) {
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < _state->nretired; i++) {
+    webp_item_t *item = _state->retired[i];
+    if (gfx_item_pinned(item)) {
+      _state->retired[kept++] = item;
+    } else {
+      gfx_item_free(item);
+    }
+  }
+  _state->nretired = kept;
+}
+
+// Writer side, mutex held: item is no longer in any slot, free it once
+// the readers have moved on
+static void gfx_retire(webp_item_t *item) {
+  if (!item) return;
+  gfx_reclaim();
+  _state->retired[_state->nretired++] = item;
+  gfx_reclaim();
+}
+
+// Writer side, mutex held: make item the slot's content, retire the old one
+static void gfx_swap_locked(uint8_t slot, webp_item_t *item,
+                            const webp_meta_t *meta) {
+  webp_item_t *old = atomic_load(&_state->slots[slot]);
+  if (!meta && old) {
+    ESP_LOGW(TAG, "update_slot: no metadata, using previous");
+    item->meta = old->meta;
+  }
+  atomic_store(&_state->slots[slot], item);
+  gfx_retire(old);
+}
+
+static uint8_t gfx_publish(uint8_t slot, webp_item_t *item,
+                           const webp_meta_t *meta) {
+  if (pdTRUE != xSemaphoreTake(_state->mutex, portMAX_DELAY)) {
+    ESP_LOGE(TAG, "update_slot: could not take gfx mutex");
     return 1;
   }
+  gfx_swap_locked(slot, item, meta);
+  xSemaphoreGive(_state->mutex);
+  return 0;
+}
 
+static bool gfx_slot_writable(uint8_t slot, const uint8_t *webp, size_t len) {
+  if (slot == DRAW_SLOT || slot >= _state->nslots) {
+    ESP_LOGE(TAG, "update_slot: slot %d is not writable", slot);
+    return false;
+  }
   // Buffer sanity checks
   if (webp == NULL || len == 0 || !validate_webp_signature(webp, len)) {
     ESP_LOGE(TAG, "update_slot: buffer (%zu) isn't valid WebP", len);
+    return false;
+  }
+  return true;
+}
+
+// Copy a buffer into the prescribed slot
+// Caller should free buffer
+uint8_t gfx_update_slot(uint8_t slot, const void *webp, size_t len,
+                        const webp_meta_t *meta) {
+  if (!gfx_slot_writable(slot, webp, len)) return 1;
+
+  // Always a fresh buffer, readers may still be on the old one
+  uint8_t *buf = mem_pool_alloc_bulk(len);
+  webp_item_t *item = buf ? gfx_item_wrap(buf, len, meta) : NULL;
+  if (!item) {
+    ESP_LOGE(TAG, "update_slot: alloc(%zu) failed", len);
+    mem_pool_free(buf);
     return 1;
   }
-  // Atomic swap
-  // Take mutex
-  if (pdTRUE != xSemaphoreTake(_state->mutex, portMAX_DELAY)) {
-    ESP_LOGE(TAG, "update_slot: could not take gfx mutex");
+  memcpy(buf, webp, len);
+
+  if (gfx_publish(slot, item, meta) != 0) {
+    gfx_item_free(item);
     return 1;
   }
+  return 0;
+}
 
-  webp_item_t *old = _state->slots[slot];
+// Hand a buffer to the prescribed slot, no copy
+uint8_t gfx_update_slot_take(uint8_t slot, uint8_t *webp, size_t len,
+                             const webp_meta_t *meta) {
+  if (!gfx_slot_writable(slot, webp, len)) return 1;
 
-  if (!old) {
-    old = calloc(1, sizeof(*old));
-    if (!old) {
-      ESP_LOGE(TAG, "update_slot: calloc failed");
-      xSemaphoreGive(_state->mutex);
-      return 1;
-    }
-    _state->slots[slot] = old;  // Bail gracefully down the line
+  webp_item_t *item = gfx_item_wrap(webp, len, meta);
+  if (!item) {
+    ESP_LOGE(TAG, "update_slot: alloc failed");
+    return 1;
+  }
+  if (gfx_publish(slot, item, meta) != 0) {
+    gfx_item_unwrap(item);  // webp stays with the caller
+    return 1;
   }
+  return 0;
+}
 
-  // Reallocate buffer if needed
-  if (!old->buf || old->size < len) {
-    ESP_LOGI(TAG, "update_slot: heap before update: %zu",
-             heap_caps_get_free_size(MALLOC_CAP_8BIT));
-    uint8_t *new_buf = realloc(old->buf, len);
-    if (!new_buf) {
-      ESP_LOGE(TAG, "update_slot: realloc(%zu) failed", len);
-      xSemaphoreGive(_state->mutex);  // release mutex and bail
-      return 1;
+#ifdef GFX_SLOT_STRESS
+typedef struct {
+  const uint8_t *webp;
+  size_t len;
+  uint32_t seed;
+  int64_t until_us;
+  uint32_t ops;
+  SemaphoreHandle_t done;
+} gfx_stress_t;
+
+static void gfx_stress_writer(void *arg) {
+  gfx_stress_t *w = arg;
+  while (esp_timer_get_time() < w->until_us) {
+    w->seed = w->seed * 1664525u + 1013904223u;  // LCG
+    uint32_t r = w->seed >> 8;
+    uint8_t slot = 1 + r % (_state->nslots - 1);
+    webp_meta_t meta = {.palette_mode = (r >> 4) % PALETTE_COUNT};
+    switch ((r >> 12) % 4) {
+      case 0: {
+        uint8_t *buf = mem_pool_alloc_bulk(w->len);
+        if (!buf) break;
+        memcpy(buf, w->webp, w->len);
+        if (gfx_update_slot_take(slot, buf, w->len, &meta)) {
+          mem_pool_free(buf);
+        }
+        break;
+      }
+      case 1:
+        gfx_update_slot(slot, w->webp, w->len, &meta);
+        break;
+      case 2:
+        if (gfx_activate_slot(slot) == 0) gfx_draw_slot(DRAW_SLOT);
+        break;
+      default:
+        gfx_free_slot(slot);
+        break;
     }
-    old->buf = new_buf;
-    old->size = len;
+    w->ops++;
+    vTaskDelay(pdMS_TO_TICKS(r % 8));
   }
+  xSemaphoreGive(w->done);
+  vTaskDelete(NULL);
+}
 
-  // Copy over
-  memcpy(old->buf, webp, len);
-  old->len = len;
-  // copy struct by value
-  if (meta) {
-    old->meta = *meta;
+// Writers on both cores hammer the slots while the pipeline draws them.
+// Freed items are zeroed, so a reader that outlived its pin shows up as
+// a decode error. Every item must be in a slot or freed at the end.
+void gfx_slot_stress(const void *webp, size_t len, uint32_t secs) {
+  enum { WRITERS = 2 };
+  gfx_stress_t w[WRITERS];
+  SemaphoreHandle_t done = xSemaphoreCreateCounting(WRITERS, 0);
+  uint32_t errors = _state->stats.errors;
+  int64_t until_us = esp_timer_get_time() + (int64_t)secs * 1000000;
+
+  for (int i = 0; i < WRITERS; i++) {
+    w[i] = (gfx_stress_t){.webp = webp,
+                          .len = len,
+                          .seed = 0x9e3779b9u * (i + 1),
+                          .until_us = until_us,
+                          .done = done};
+    xTaskCreatePinnedToCore(gfx_stress_writer, "gfx_stress", 3072, &w[i],
+                            GFX_TASK_PRIO, NULL, i % 2);
+  }
+  for (int i = 0; i < WRITERS; i++) {
+    xSemaphoreTake(done, portMAX_DELAY);
+  }
+  vSemaphoreDelete(done);
+
+  // Let the pipeline settle on what's in the draw slot, then collect
+  gfx_draw_slot(DRAW_SLOT);
+  vTaskDelay(pdMS_TO_TICKS(500));
+  xSemaphoreTake(_state->mutex, portMAX_DELAY);
+  gfx_reclaim();
+  int held = _state->nretired;
+  for (uint8_t i = 0; i < _state->nslots; i++) {
+    held += atomic_load(&_state->slots[i]) != NULL;
+  }
+  xSemaphoreGive(_state->mutex);
+
+  int items = atomic_load(&_state->items);
+  errors = _state->stats.errors - errors;
+  if (items != held || errors) {
+    ESP_LOGE(TAG, "slot stress FAILED: %d items live, %d accounted for, "
+             "%lu decode errors", items, held, errors);
   } else {
-    // Default or previous?
-    ESP_LOGW(TAG, "update_slot: no metadata, using previous");
+    ESP_LOGI(TAG, "slot stress ok: %lu + %lu writes, %d items held",
+             w[0].ops, w[1].ops, held);
   }
+}
+#endif
 
-  // Release mutex
-  if (pdTRUE != xSemaphoreGive(_state->mutex)) {
-    ESP_LOGE(TAG, "update_slot: could not give gfx mutex");
-    return 1;
+static void gfx_frame_timer_cb(void *arg) { xTaskNotifyGive(_state->task); }
+
+// Wake the present stage at an absolute time. esp_timer rather than a
+// notify timeout, ticks are 10 ms on some of our builds.
+static void gfx_wake_at(int64_t when_us) {
+  esp_timer_stop(_state->frame_timer);
+  esp_timer_start_once(_state->frame_timer,
+                       MAX(when_us - esp_timer_get_time(), 1));
+}
+
+// Nothing left to draw for now, wake when the alert ends, else for the
+// next app's standby or the end of the dwell. Without either only a
+// command wakes us.
+static void gfx_wake_idle(int64_t alert_end_us, uint32_t dwell_secs,
+                          int64_t dwell_end_us, bool standby_sent) {
+  if (alert_end_us) {
+    gfx_wake_at(alert_end_us);
+    return;
+  }
+  if (dwell_secs == 0) {
+    esp_timer_stop(_state->frame_timer);
+    return;
   }
+  const int64_t standby_at = dwell_end_us - GFX_STANDBY_LEAD_MS * 1000LL;
+  gfx_wake_at(standby_sent ? dwell_end_us : standby_at);
+}
 
-  return 0;
+// Done with the frame at the head of the ring, let the decoder refill it
+static inline void gfx_release_frame(void) {
+  frame_ring_pop(&_state->ring);
+  xTaskNotifyGive(_state->decode_task);
+}
+
+static void gfx_record_present(int64_t late_us, uint32_t present_us) {
+  gfx_stats_t *s = &_state->stats;
+  s->presented++;
+  _state->present_us_total += present_us;
+  s->present_us_max = MAX(s->present_us_max, present_us);
+  _state->late_hist[MIN(late_us / 1000, GFX_LATE_BUCKETS - 1)]++;
+}
+
+// Point the decode worker at a new image, NULL just stops it. An item must
+// be pinned by the present stage, the decoder takes its own pin from that.
+static void gfx_decode_post(const gfx_decode_job_t *job) {
+  xQueueOverwrite(_state->decode_jobs, job);
+  xTaskNotifyGive(_state->decode_task);
+}
+
+static void gfx_decode_start(uint32_t epoch, webp_item_t *item,
+                             const uint8_t *buf, size_t len) {
+  gfx_decode_job_t job = {
+      .item = item, .buf = buf, .len = len, .epoch = epoch};
+  gfx_decode_post(&job);
+}
+
+// Hand back frames decoded for images we've since moved on from
+static void gfx_drop_stale(uint32_t epoch) {
+  frame_ring_slot_t *f;
+  while ((f = frame_ring_peek(&_state->ring)) && f->epoch != epoch) {
+    _state->stats.stale++;
+    gfx_release_frame();
+  }
+}
+
+// Keep rows [y0, y1) of the frame just drawn, the rest is unchanged since
+// the last one. A new image is copied whole.
+static void gfx_keep_shown(const frame_ring_slot_t *f, int y0, int y1) {
+  if (_state->shown_epoch != f->epoch || _state->shown_w != f->width ||
+      _state->shown_h != f->height) {
+    _state->shown_epoch = f->epoch;
+    _state->shown_w = f->width;
+    _state->shown_h = f->height;
+    y0 = 0;
+    y1 = f->height;
+  }
+  const size_t row = f->width * 4;
+  y0 = MAX(y0, 0);
+  y1 = MIN(y1, f->height);
+  if (y1 > y0) {
+    memcpy(_state->shown + y0 * row, f->pixels + y0 * row, (y1 - y0) * row);
+  }
+}
+
+// Ask the decoder for the first frame of slot's app ahead of its turn
+static void gfx_standby(uint8_t slot) {
+  atomic_store(&_state->standby_slot, slot);
+  xTaskNotifyGive(_state->decode_task);
+}
+
+// A new image was asked for, timed until its first frame is up
+static void gfx_switch_begin(int64_t now_us) {
+  _state->switch_us = now_us;
+  _state->switching = true;
+}
+
+static void gfx_switch_done(const frame_ring_slot_t *f, int64_t now_us) {
+  if (!_state->switching) return;
+  _state->switching = false;
+  const uint32_t us = now_us - _state->switch_us;
+  gfx_stats_t *s = &_state->stats;
+  s->switches++;
+  if (f->primed) s->switches_primed++;
+  _state->switch_us_total += us;
+  s->switch_us_max = MAX(s->switch_us_max, us);
+  ESP_LOGI(TAG, "[#%lu] on screen %lu us after the switch (%s)",
+           _state->counter, us, f->primed ? "standby" : "cold");
+}
+
+// Draw the frame on the panel again in a new palette, animations included,
+// without waiting for the next frame
+static void gfx_redraw_shown(uint32_t epoch, gfx_palette_t palette_mode) {
+  if (_state->shown_epoch != epoch) return;
+  display_draw_region(_state->shown, _state->shown_w, _state->shown_h, 4, 0,
+                      1, 2, gfx_palette_q(palette_mode), 0, _state->shown_h);
 }
 
+// Present stage: handles commands and puts decoded frames on the panel
+// when they're due. Decoding happens on the worker, see gfx_decode_loop.
 static void gfx_loop(void *arg) {
   ESP_LOGI(TAG, "gfx_task: running on core %d", xPortGetCoreID());
 
-  webp_decoder_t dec;
   bool anim_active = false;
-  TickType_t next_delay = portMAX_DELAY;
-  uint8_t *pixels;
-  int delay_ms;
+  bool clear_on_error = false;
+  uint32_t epoch = 0;  // Bumped for every image we start
+  webp_item_t *item = NULL;  // Pinned slot item, palette comes from it
+  uint8_t cur_slot = DRAW_SLOT;  // Where item came from
+
+  // Timeline of the image on screen
+  bool timeline_valid = false;
+  int64_t timeline_us = 0;  // Wall time of pts 0
+  int64_t next_due_us = 0;  // When the frame after the last drawn is due
+  bool starved = false;     // Already counted the current underrun
+  uint32_t skip_run = 0;    // Frames skipped in a row
+  int owed_y0 = DISPLAY_HEIGHT, owed_y1 = 0;  // Rows of skipped frames
 
   // dwell state
   uint64_t draw_start_us = 0;
+  int64_t dwell_end_us = 0;
   uint32_t dwell_secs = 0;
+  bool standby_sent = false;  // Decoder was told about the next app
+
+  // Alerts put the app on screen aside and resume it where it was
+  bool app_up = false;      // item is what's on screen
+  int64_t alert_end_us = 0;  // Alert on screen until then, 0 for none
+  bool parked = false;      // item waits for the alert to end
+  uint32_t parked_dwell_secs = 0;
+  int64_t parked_left_us = 0;  // Dwell it had left
+  uint32_t resume_idx = 0, resume_loop = 0, resume_pts_ms = 0;
 
   for (;;) {
-    gfx_cmd_t cmd;
-    bool got = xQueueReceive(_state->cmd_queue, &cmd, next_delay);
+    // Commands, decoded frames and the frame timer all wake us here
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-    if (got) {
+    gfx_cmd_t cmds[GFX_CMDS_MAX];
+    const int ncmds = gfx_take_cmds(cmds, alert_end_us != 0);
+    for (int c = 0; c < ncmds; c++) {
+      const gfx_cmd_t cmd = cmds[c];
       switch (cmd.type) {
         case CMD_DRAW_SLOT: {
-          // grab buffer & meta (atomically)
-          const uint8_t *buf;
-          size_t len;
-          webp_meta_t meta;
-          xSemaphoreTake(_state->mutex, portMAX_DELAY);
-          buf = _state->slots[DRAW_SLOT]->buf;
-          len = _state->slots[DRAW_SLOT]->len;
-          meta = _state->slots[DRAW_SLOT]->meta;
+          // Pin it, writers retire rather than free what we hold
+          item = gfx_pin_slot(GFX_READER_PRESENT, cmd.slot);
           _state->counter++;  // Keep track
-          xSemaphoreGive(_state->mutex);
+          app_up = item != NULL;
+          parked = false;
+          alert_end_us = 0;
+          resume_idx = resume_loop = resume_pts_ms = 0;
+          if (!item) {
+            ESP_LOGW(TAG, "[#%lu] slot %d is empty", _state->counter,
+                     cmd.slot);
+            gfx_decode_start(++epoch, NULL, NULL, 0);
+            anim_active = false;
+            dwell_secs = 0;
+            _state->switching = false;
+            atomic_store(&_state->rotating, false);
+            break;
+          }
+          cur_slot = cmd.slot;
+          __atomic_store_n(&_state->last_slot, cur_slot, __ATOMIC_RELAXED);
 
           // dwell instrumentation
-          dwell_secs = meta.dwell_secs;
+          dwell_secs =
+              __atomic_load_n(&item->meta.dwell_secs, __ATOMIC_RELAXED);
           draw_start_us = esp_timer_get_time();
-
-          // init decoder
-          int err = webp_decoder_init(&dec, buf, len);
-          if (err == 0) {
-            anim_active = true;
-            next_delay = 0;  // first frame immediately
-            ESP_LOGI(TAG, "[#%lu] drawing (dwell=%lus)", _state->counter,
-                     dwell_secs);
-          } else {
-            ESP_LOGE(TAG, "[#%lu] decoder init failed (%d)", _state->counter,
-                     err);
-            anim_active = false;
-            next_delay = portMAX_DELAY;
-          }
+          dwell_end_us = draw_start_us + dwell_secs * 1000000LL;
+          standby_sent = false;
+          gfx_switch_begin(draw_start_us);
+          atomic_store(&_state->rotating,
+                       cur_slot != DRAW_SLOT && dwell_secs > 0);
+
+          gfx_decode_start(++epoch, item, item->buf, item->len);
+          anim_active = true;
+          clear_on_error = false;
+          timeline_valid = false;  // first frame immediately
+          ESP_LOGI(TAG, "[#%lu] drawing slot %d (dwell=%lus)",
+                   _state->counter, cur_slot, dwell_secs);
           break;
         }
         case CMD_DRAW_BUFFER: {
           // pull the buf+len directly out of the command
           const uint8_t *buf = cmd.u.draw_buffer.buf;
           size_t len = cmd.u.draw_buffer.len;
+          const uint32_t secs = cmd.u.draw_buffer.secs;
+          draw_start_us = esp_timer_get_time();
+          // An alert sets the app aside with the dwell it has left, the
+          // decoder keeps its place
+          const gfx_decode_job_t job = {.buf = buf,
+                                        .len = len,
+                                        .epoch = ++epoch,
+                                        .park = secs && app_up,
+                                        .hold = secs && parked};
+          if (job.park) {
+            parked = true;
+            parked_dwell_secs = dwell_secs;
+            parked_left_us = MAX(dwell_end_us - (int64_t)draw_start_us, 0);
+          } else if (!secs) {
+            parked = false;  // Up until the next command, nothing resumes
+          }
+          alert_end_us = secs ? draw_start_us + secs * 1000000LL : 0;
+          app_up = false;
           // Keep our stats
           dwell_secs = 0;  // show until next command
-          draw_start_us = esp_timer_get_time();
-          // Init our decoder on this buffer
-          if (webp_decoder_init(&dec, buf, len) == 0) {
-            anim_active = true;
-            next_delay = 0;
-          } else {
-            ESP_LOGE(TAG, "gfx_task: DRAW_BUFFER decoder init failed");
-            display_clear();
-            anim_active = false;
-            next_delay = pdMS_TO_TICKS(1000);
+          gfx_switch_begin(draw_start_us);
+          if (!parked) atomic_store(&_state->rotating, false);
+          gfx_decode_post(&job);
+          if (secs) {
+            ESP_LOGI(TAG, "[#%lu] alert for %lus, slot %d %s",
+                     _state->counter, secs, cur_slot,
+                     parked ? "parked" : "stopped");
           }
+          anim_active = true;
+          clear_on_error = true;
+          timeline_valid = false;
           break;
         }
 
         case CMD_CLEAR: {
-          if (anim_active) {
-            webp_decoder_deinit(&dec);
-            anim_active = false;
-          }
+          // Also lets go of a still we may be holding
+          gfx_decode_start(++epoch, NULL, NULL, 0);
+          anim_active = false;
+          dwell_secs = 0;
+          app_up = parked = false;
+          alert_end_us = 0;
+          _state->switching = false;
+          atomic_store(&_state->rotating, false);
           display_clear();
           ESP_LOGI(TAG, "CMD_CLEAR");
-          next_delay = portMAX_DELAY;
+          break;
+        }
+        case CMD_SET_BRIGHTNESS: {
+          // The panel clears on a change, put the frame back rather than
+          // wait for the next one, which a still never has
+          if (cmd.u.set_brightness.pct == get_brightness()) break;
+          display_set_brightness(cmd.u.set_brightness.pct);
+          gfx_redraw_shown(epoch, gfx_item_palette(item));
+          break;
+        }
+        case CMD_PREVIEW: {
+          taskENTER_CRITICAL(&_state->cmd_lock);
+          const int8_t r = _state->preview_ready;
+          _state->preview_ready = -1;
+          _state->preview_busy = r;
+          taskEXIT_CRITICAL(&_state->cmd_lock);
+          // Taken back by a newer one, its command follows
+          if (r < 0) break;
+
+          // Stop what's playing and put the partial image up as it is,
+          // the decoder gets the whole body once it's in
+          gfx_decode_start(++epoch, NULL, NULL, 0);
+          anim_active = false;
+          dwell_secs = 0;
+          app_up = false;
+          _state->switching = false;
+          _state->shown_w = _state->preview_w[r];
+          _state->shown_h = _state->preview_h[r];
+          memcpy(_state->shown, _state->preview[r],
+                 (size_t)_state->shown_w * _state->shown_h * 4);
+          taskENTER_CRITICAL(&_state->cmd_lock);
+          _state->preview_busy = -1;
+          taskEXIT_CRITICAL(&_state->cmd_lock);
+          _state->shown_epoch = epoch;
+          gfx_redraw_shown(epoch, PALETTE_NORMAL);
           break;
         }
         case CMD_SET_PALETTE: {
-          // Change palette on the given slot (e.g. DRAW_SLOT)
-          xSemaphoreTake(_state->mutex, portMAX_DELAY);
-          _state->slots[cmd.slot]->meta.palette_mode =
-              cmd.u.set_palette.palette;
+          // gfx_set_palette already stored it on the slot's item
           ESP_LOGI(TAG, "[#%lu] Palette changed to %s", _state->counter,
                    gfx_palette_name(cmd.u.set_palette.palette));
-          xSemaphoreGive(_state->mutex);
-          // We need to kick a frame redraw from here..
-          // Else let it happen the next frame?
+          // Now, rather than on the next frame, which a still never has
+          gfx_redraw_shown(epoch, gfx_item_palette(item));
           break;
         }
         default:
           ESP_LOGW(TAG, "gfx_task: unknown command type %d", cmd.type);
           break;
       }
-    } else if (anim_active) {
-      // check dwell expiry
-      if (dwell_secs > 0 && (esp_timer_get_time() - draw_start_us) >=
-                                ((uint64_t)dwell_secs * 1000000ULL)) {
-        ESP_LOGI(TAG, "[#%lu] dwell (%lus) expired after %lu loops",
-                 _state->counter, dwell_secs, dec.loop_count + 1);
-        webp_decoder_deinit(&dec);
+    }
+
+    gfx_drop_stale(epoch);
+    int64_t now = esp_timer_get_time();
+
+    // Alert's over, back to the frame it interrupted unless a draw came in
+    // meanwhile. Either way a command or the new frames wake us.
+    if (alert_end_us && now >= alert_end_us) {
+      alert_end_us = 0;
+      if (gfx_content_pending()) {
+        parked = false;
+        xTaskNotifyGive(_state->task);
+      } else if (parked) {
+        parked = false;
+        app_up = true;
+        dwell_secs = parked_dwell_secs;
+        dwell_end_us = now + parked_left_us;
+        draw_start_us = now;
+        standby_sent = false;
+        gfx_switch_begin(now);
+        atomic_store(&_state->rotating,
+                     cur_slot != DRAW_SLOT && dwell_secs > 0);
+        const gfx_decode_job_t job = {.item = item,
+                                      .buf = item->buf,
+                                      .len = item->len,
+                                      .epoch = ++epoch,
+                                      .resume = true,
+                                      .resume_idx = resume_idx,
+                                      .resume_loop = resume_loop,
+                                      .resume_pts_ms = resume_pts_ms};
+        gfx_decode_post(&job);
+        anim_active = true;
+        clear_on_error = false;
+        timeline_valid = false;
+        ESP_LOGI(TAG, "[#%lu] alert over, slot %d resumes at frame %lu",
+                 _state->counter, cur_slot, resume_idx + 1);
+      } else {
+        // Nothing to go back to
+        gfx_decode_start(++epoch, NULL, NULL, 0);
         anim_active = false;
-        next_delay = portMAX_DELAY;
+        display_clear();
+      }
+      continue;
+    }
+
+    // Get the next app's first frame decoded shortly before it's due
+    const int64_t standby_at = dwell_end_us - GFX_STANDBY_LEAD_MS * 1000LL;
+    if (GFX_STANDBY_LEAD_MS > 0 && dwell_secs > 0 && !standby_sent &&
+        now >= standby_at) {
+      standby_sent = true;
+      uint8_t next = gfx_rotation_next(cur_slot);
+      if (next && next != cur_slot) gfx_standby(next);
+    }
+
+    // check dwell expiry, stills and finished animations included
+    if (dwell_secs > 0 && now >= dwell_end_us) {
+      ESP_LOGI(TAG, "[#%lu] dwell (%lus) expired", _state->counter,
+               dwell_secs);
+      dwell_secs = 0;
+      // On to the next app, the command wakes us straight away
+      uint8_t next = gfx_rotation_next(cur_slot);
+      if (next == cur_slot && atomic_load(&_state->slots[next]) == item) {
+        // Up again and unchanged, carry on rather than start over
+        dwell_secs =
+            __atomic_load_n(&item->meta.dwell_secs, __ATOMIC_RELAXED);
+        dwell_end_us = now + dwell_secs * 1000000LL;
+      } else if (next && gfx_draw_slot(next) == 0) {
         continue;
+      } else {
+        gfx_decode_start(++epoch, NULL, NULL, 0);
+        anim_active = false;
+        atomic_store(&_state->rotating, false);
+      }
+    }
+    if (!anim_active) {
+      gfx_wake_idle(alert_end_us, dwell_secs, dwell_end_us, standby_sent);
+      continue;
+    }
+
+    // Put up every frame that's due. Frames are scheduled on the image's
+    // own timeline, so time spent drawing never pushes later frames back.
+    frame_ring_slot_t *f;
+    while ((f = frame_ring_peek(&_state->ring))) {
+      if (!timeline_valid) {
+        timeline_us = now - (int64_t)f->pts_ms * 1000;
+        timeline_valid = true;
+      }
+      int64_t due_us = timeline_us + (int64_t)f->pts_ms * 1000;
+      if (now < due_us) {
+        gfx_wake_at(due_us);
+        break;
+      }
+      if (f->end) break;
+
+      int64_t late_us = now - due_us;
+      if (late_us > GFX_RESYNC_MS * 1000) {
+        // Too far behind to catch up, carry on from here
+        ESP_LOGD(TAG, "[#%lu] %lld ms late, restarting timeline",
+                 _state->counter, late_us / 1000);
+        timeline_us += late_us;
+        late_us = 0;
+        _state->stats.resyncs++;
       }
 
-      // step one frame
-      int64_t t0 = esp_timer_get_time();
-      if (webp_decoder_next_frame(&dec, &pixels, &delay_ms)) {
-        // draw and schedule next
-        gfx_palette_t palette_mode =
-            _state->slots[DRAW_SLOT]->meta.palette_mode;
-        if (palette_mode != PALETTE_NORMAL) {
-          const float (*matrix)[3] = gfx_palette_matrix(palette_mode);
-          gfx_palette_apply(pixels, dec.info.canvas_width,
-                            dec.info.canvas_height, matrix);
-          if (dec.frame_idx == 1) {
-            ESP_LOGD(TAG, "[#%lu] palette shDfted to %s in %lu ms ",
-                     _state->counter, gfx_palette_name(palette_mode),
-                     (uint32_t)(esp_timer_get_time() - t0) / 1000);
-          }
+      // Rows a skipped frame changed are owed to the next one drawn
+      owed_y0 = MIN(owed_y0, f->dirty_y0);
+      owed_y1 = MAX(owed_y1, f->dirty_y1);
+      if (late_us >= (int64_t)f->delay_ms * 1000 && skip_run < GFX_MAX_SKIP &&
+          frame_ring_count(&_state->ring) > 1) {
+        // Its time on screen is already over and the next one is ready
+        _state->stats.skipped++;
+        skip_run++;
+        gfx_release_frame();
+        continue;
+      }
+
+      if (f->epoch != _state->shown_epoch) {
+        // First frame of an image, whatever is on the panel has to go
+        owed_y0 = 0;
+        owed_y1 = f->height;
+      }
+      display_draw_region(f->pixels, f->width, f->height, 4, 0, 1, 2,
+                          gfx_palette_q(gfx_item_palette(item)), owed_y0,
+                          owed_y1);
+      gfx_keep_shown(f, owed_y0, owed_y1);
+#ifdef DISPLAY_BENCHMARK
+      if (f->loop_count == 0 && f->frame_idx == 1) {
+        display_benchmark(f->pixels, f->width, f->height, 10);
+      }
+#endif
+      int64_t t1 = esp_timer_get_time();
+      gfx_record_present(late_us, t1 - now);
+      gfx_switch_done(f, t1);
+      if (app_up) {
+        // Where the app picks up again after an alert
+        resume_idx = f->frame_idx;
+        resume_loop = f->loop_count;
+        resume_pts_ms = f->pts_ms + f->delay_ms;
+        if (resume_idx >= f->frame_count) {
+          resume_idx = 0;
+          resume_loop++;
         }
+      }
+      owed_y0 = DISPLAY_HEIGHT;
+      owed_y1 = 0;
+      skip_run = 0;
+      starved = false;
+
+      if (f->still) {
+        // Nothing else is coming, sleep until the next command. The frame
+        // stays in the ring until the image changes.
+        ESP_LOGI(TAG, "[#%lu] still image, decoded in %lu us", _state->counter,
+                 f->decode_us);
+        anim_active = false;
+        // The alert or dwell still has to end, no frame will see to it
+        gfx_wake_idle(alert_end_us, dwell_secs, dwell_end_us, standby_sent);
+        break;
+      }
 
-        display_draw(pixels, dec.info.canvas_width, dec.info.canvas_height, 4,
-                     0, 1, 2);
-        int64_t t1 = esp_timer_get_time();
-        // Finished playing one loop of our webp
-        if (dec.loop_count > 0 && dec.frame_idx == 1) {
-          uint32_t loop_ms = (t1 - draw_start_us) / 1000;
-          ESP_LOGI(TAG, "[#%lu] loop %lu: %lu ms (%lu frames @ ~%lu ms/frame)",
-                   _state->counter, dec.loop_count, loop_ms,
-                   dec.info.frame_count, loop_ms / dec.info.frame_count);
+      // Finished playing one loop of our webp
+      if (f->loop_count > 0 && f->frame_idx == 1) {
+        uint32_t loop_ms = (t1 - draw_start_us) / 1000;
+        gfx_stats_t stats;
+        gfx_get_stats(&stats);
+        ESP_LOGI(TAG,
+                 "[#%lu] loop %lu: %lu ms (%lu frames @ ~%lu ms/frame)",
+                 _state->counter, f->loop_count, loop_ms, f->frame_count,
+                 loop_ms / (f->frame_count * f->loop_count));
+        ESP_LOGD(TAG,
+                 "decode ~%lu us (max %lu), present ~%lu us (max %lu), "
+                 "%lu underruns, %lu skipped, late p50 %lu ms p99 %lu ms",
+                 stats.decode_us_avg, stats.decode_us_max,
+                 stats.present_us_avg, stats.present_us_max,
+                 stats.underruns, stats.skipped, stats.late_p50_ms,
+                 stats.late_p99_ms);
+        ESP_LOGD(TAG,
+                 "commands: %lu posted, %lu coalesced, depth max %lu, "
+                 "latency ~%lu us (max %lu)",
+                 stats.cmd_posted, stats.cmd_coalesced, stats.cmd_depth_max,
+                 stats.cmd_latency_us_avg, stats.cmd_latency_us_max);
+        ESP_LOGD(TAG,
+                 "switches: %lu, %lu from standby, ~%lu us (max %lu)",
+                 stats.switches, stats.switches_primed, stats.switch_us_avg,
+                 stats.switch_us_max);
+      }
+
+      next_due_us = due_us + (int64_t)f->delay_ms * 1000;
+      gfx_release_frame();
+      now = t1;
+    }
+
+    if (!f) {
+      // Decoder is behind, it wakes us once the frame lands. Check back
+      // when the frame is due so we know if it missed.
+      if (timeline_valid && !starved) {
+        if (now >= next_due_us) {
+          _state->stats.underruns++;
+          starved = true;
+        } else {
+          gfx_wake_at(next_due_us);
         }
-        // Track how long each frame took to decode + draw
-        // ESP_LOGI(TAG, "gfx: frame %2d/%2lu loop %2d decode %4lldµs delay
-        // %3dms",
-        //          dec.frame_idx, dec.info.frame_count, dec.loop_count + 1,
-        //          (long long)(t1 - t0), delay_ms);
-        next_delay = pdMS_TO_TICKS(delay_ms);
+      }
+      continue;
+    }
 
+    if (f->end && (f->error || now >= timeline_us + f->pts_ms * 1000LL)) {
+      if (f->error) {
+        _state->stats.errors++;
+        ESP_LOGE(TAG, "[#%lu] decoder init failed", _state->counter);
+        if (clear_on_error) display_clear();
       } else {
-        uint64_t t1 = esp_timer_get_time();
-        uint32_t total_ms = (t1 - draw_start_us) / 1000;
-        uint32_t loops = (dec.info.loop_count > 0 ? dec.info.loop_count
-                                                  : dec.loop_count + 1);
-        uint32_t total_frames = dec.info.frame_count * loops;
-
+        uint32_t total_ms = (now - draw_start_us) / 1000;
+        uint32_t total_frames = MAX(f->frame_count * f->loop_count, 1);
         ESP_LOGI(TAG,
-                 "[#%lu] total loops %lu: %lu ms (%lu frames @ ~%lu ms/frame)",
-                 _state->counter, loops, total_ms, total_frames,
+                 "[#%lu] total loops %lu: %lu ms (%lu frames @ ~%lu "
+                 "ms/frame)",
+                 _state->counter, f->loop_count, total_ms, total_frames,
                  total_ms / total_frames);
-        webp_decoder_deinit(&dec);
-        anim_active = false;
-        next_delay = portMAX_DELAY;
       }
+      gfx_release_frame();
+      anim_active = false;
+      gfx_wake_idle(alert_end_us, dwell_secs, dwell_end_us, standby_sent);
     }
-    // else idle waiting for next command…
   }
 }
 
+// Copy the part of the canvas that fits the panel into a ring frame
+static void gfx_copy_frame(frame_ring_slot_t *f, const uint8_t *pixels,
+                           uint32_t w, uint32_t h) {
+  f->width = MIN(w, DISPLAY_WIDTH);
+  f->height = MIN(h, DISPLAY_HEIGHT);
+  const size_t row = (size_t)f->width * 4;
+  if (f->width == w) {
+    memcpy(f->pixels, pixels, row * f->height);
+    return;
+  }
+  for (uint32_t y = 0; y < f->height; y++) {
+    memcpy(f->pixels + y * row, pixels + (size_t)y * w * 4, row);
+  }
+}
+
+// Single frame images skip the animation decoder (and its two canvases)
+// and are decoded once, straight into the ring frame, cropped to the panel.
+static bool webp_is_still(const uint8_t *buf, size_t len) {
+  WebPBitstreamFeatures ft;
+  return WebPGetFeatures(buf, len, &ft) == VP8_STATUS_OK && !ft.has_animation;
+}
+
+static bool webp_decode_still(frame_ring_slot_t *f, const uint8_t *buf,
+                              size_t len) {
+  WebPDecoderConfig config;
+  if (!WebPInitDecoderConfig(&config) ||
+      WebPGetFeatures(buf, len, &config.input) != VP8_STATUS_OK) {
+    return false;
+  }
+  f->width = MIN(config.input.width, DISPLAY_WIDTH);
+  f->height = MIN(config.input.height, DISPLAY_HEIGHT);
+  if (f->width != config.input.width || f->height != config.input.height) {
+    config.options.use_cropping = 1;
+    config.options.crop_left = 0;
+    config.options.crop_top = 0;
+    config.options.crop_width = f->width;
+    config.options.crop_height = f->height;
+  }
+  config.output.colorspace = MODE_rgbA;  // Same as the animation path
+  config.output.is_external_memory = 1;
+  config.output.u.RGBA.rgba = f->pixels;
+  config.output.u.RGBA.stride = f->width * 4;
+  config.output.u.RGBA.size = FRAME_RING_FRAME_BYTES;
+  if (WebPDecode(buf, len, &config) != VP8_STATUS_OK) {
+    ESP_LOGE(TAG, "webp_decode_still: decode failed");
+    return false;
+  }
+  return true;
+}
+
+// One image on the decode stage: the live one filling the ring, or the
+// standby getting the next app's first frame ready ahead of its turn
+typedef struct {
+  webp_decoder_t dec;
+  gfx_decode_job_t job;
+  bool active;      // More frames to come
+  bool still;       // Decoded in one go, no decoder
+  bool primed;      // Frame 0 is waiting in _state->standby
+  uint32_t pts_ms;  // Start of the next frame on the image's timeline
+  // Decoder canvas holding frame 0 until the next frame, cached on the
+  // switch since the standby decoder runs without a cache
+  const uint8_t *frame0;
+  int frame0_delay_ms;
+} gfx_decode_ctx_t;
+
+static void gfx_decode_begin(gfx_decode_ctx_t *c, const gfx_decode_job_t *job,
+                             bool cache) {
+  webp_decoder_deinit(&c->dec);
+  c->job = *job;
+  c->active = job->buf != NULL;
+  c->primed = false;
+  c->pts_ms = 0;
+  c->frame0 = NULL;
+  c->still = c->active && webp_is_still(job->buf, job->len);
+  if (c->active && !c->still &&
+      webp_decoder_init(&c->dec, job->buf, job->len, cache) != 0) {
+    ESP_LOGE(TAG, "gfx_decode: decoder init failed");
+  }
+}
+
+// Decode c's next frame into f
+static void gfx_decode_next(gfx_decode_ctx_t *c, frame_ring_slot_t *f) {
+  int64_t t0 = esp_timer_get_time();
+  webp_decoder_t *dec = &c->dec;
+  uint8_t *pixels;
+  int delay_ms;
+  bool cached;
+  f->epoch = c->job.epoch;
+  f->pts_ms = c->pts_ms;
+  f->end = false;
+  f->error = false;
+  f->still = false;
+  f->primed = false;
+  if (c->still) {
+    f->still = webp_decode_still(f, c->job.buf, c->job.len);
+    f->end = f->error = !f->still;
+    f->delay_ms = 0;
+    f->dirty_y0 = 0;
+    f->dirty_y1 = f->height;
+    f->frame_idx = 1;
+    f->loop_count = 0;
+    f->frame_count = 1;
+    c->active = false;
+  } else if (!dec->dec) {
+    f->end = true;
+    f->error = true;
+    c->active = false;
+  } else if (webp_decoder_next_frame(dec, &pixels, &delay_ms, &cached)) {
+    if (!cached) {
+      webp_decoder_cache_frame(dec, pixels, delay_ms);
+    }
+    if (!dec->cache.data && dec->frame_idx == 1 && dec->loop_count == 0) {
+      c->frame0 = pixels;
+      c->frame0_delay_ms = delay_ms;
+    }
+    gfx_copy_frame(f, pixels, dec->info.canvas_width,
+                   dec->info.canvas_height);
+    f->delay_ms = MIN(MAX(delay_ms, GFX_MIN_FRAME_MS), UINT16_MAX);
+    c->pts_ms += f->delay_ms;
+    f->dirty_y0 = MIN(dec->dirty_y0, f->height);
+    f->dirty_y1 = MIN(dec->dirty_y1, f->height);
+    f->frame_idx = dec->frame_idx;
+    f->loop_count = dec->loop_count;
+    f->frame_count = dec->info.frame_count;
+    // A one frame animation is a still too, no point decoding it again
+    if (dec->info.frame_count == 1) {
+      f->still = true;
+      webp_decoder_deinit(dec);
+      c->active = false;
+    }
+  } else {
+    f->end = true;
+    f->frame_count = dec->info.frame_count;
+    f->loop_count = (dec->info.loop_count > 0 ? dec->info.loop_count
+                                              : dec->loop_count + 1);
+    webp_decoder_deinit(dec);
+    c->active = false;
+  }
+  f->decode_us = esp_timer_get_time() - t0;
+  if (!f->end) {
+    _state->stats.decoded++;
+    _state->decode_us_total += f->decode_us;
+    _state->stats.decode_us_max =
+        MAX(_state->stats.decode_us_max, f->decode_us);
+  }
+}
+
+// Decode the first frame of the app in slot into _state->standby. The
+// item stays pinned until it's switched to or dropped.
+static bool gfx_standby_prepare(gfx_decode_ctx_t *c, uint8_t slot) {
+  webp_item_t *item = gfx_pin_slot(GFX_READER_STANDBY, slot);
+  if (!item) return false;
+  const gfx_decode_job_t job = {
+      .item = item, .buf = item->buf, .len = item->len};
+  gfx_decode_begin(c, &job, false);
+  gfx_decode_next(c, &_state->standby);
+  c->primed = !_state->standby.end;
+  ESP_LOGD(TAG, "gfx_decode: slot %d standing by, %lu us", slot,
+           _state->standby.decode_us);
+  return c->primed;
+}
+
+// Done with a standby or parked decoder and the item reader pinned for it
+static void gfx_decode_drop(gfx_decode_ctx_t *c, int reader) {
+  webp_decoder_deinit(&c->dec);
+  memset(c, 0, sizeof(*c));
+  gfx_unpin(reader);
+}
+
+// Put the live decoder aside while an alert plays, pinned so the item
+// stays. Stills and finished images are cheaper to start over.
+static void gfx_park(gfx_decode_ctx_t *live, gfx_decode_ctx_t *parked) {
+  gfx_decode_drop(parked, GFX_READER_PARKED);
+  if (!live->active || live->primed || !live->job.item) return;
+  atomic_store(&_state->pinned[GFX_READER_PARKED], live->job.item);
+  *parked = *live;
+  memset(live, 0, sizeof(*live));
+}
+
+// Back to the frame the present stage was on when the alert came. Frames
+// the ring held then come again from the frame cache. Without one we carry
+// on from where the decoder got to, a ring's worth of frames on at most.
+static void gfx_decode_seek(gfx_decode_ctx_t *c, const gfx_decode_job_t *job) {
+  webp_decoder_t *d = &c->dec;
+  if (!d->dec || !d->cache.data || job->resume_idx >= d->cache.filled) {
+    return;
+  }
+  d->frame_idx = job->resume_idx;
+  d->loop_count = job->resume_loop;
+  d->replaying = true;
+  c->pts_ms = job->resume_pts_ms;
+}
+
+// Decode stage: runs the WebP decoder ahead of the present task, filling
+// the frame ring whenever it has room. Pinned to the other core so decode
+// time no longer eats into frame durations.
+static void gfx_decode_loop(void *arg) {
+  ESP_LOGI(TAG, "gfx_decode: running on core %d", xPortGetCoreID());
+
+  gfx_decode_ctx_t live = {0}, standby = {0}, parked = {0};
+  uint8_t standby_slot = 0;  // Asked for, not prepared yet
+
+  for (;;) {
+    gfx_decode_job_t next;
+    if (xQueueReceive(_state->decode_jobs, &next, 0) == pdTRUE) {
+      // Before the pin moves, the parked item takes its own
+      if (next.park) gfx_park(&live, &parked);
+      atomic_store(&_state->pinned[GFX_READER_DECODE], next.item);
+      if (next.item &&
+          atomic_load(&_state->pinned[GFX_READER_PRESENT]) != next.item) {
+        // Present stage moved on and may have let it be freed, a newer
+        // job is already on its way
+        next.buf = NULL;
+      }
+      if (next.buf && next.resume && parked.job.item == next.item) {
+        webp_decoder_deinit(&live.dec);
+        live = parked;
+        memset(&parked, 0, sizeof(parked));
+        live.job.epoch = next.epoch;
+        gfx_decode_seek(&live, &next);
+        ESP_LOGD(TAG, "gfx_decode: resuming at frame %lu of loop %lu",
+                 live.dec.frame_idx, live.dec.loop_count);
+      } else if (next.buf && standby.primed &&
+                 standby.job.item == next.item) {
+        // Frame 0 is ready, carry on with the standby decoder
+        webp_decoder_deinit(&live.dec);
+        live = standby;
+        memset(&standby, 0, sizeof(standby));
+        live.job.epoch = next.epoch;
+        if (live.frame0) {
+          webp_decoder_init_cache(&live.dec);
+          webp_decoder_cache_frame(&live.dec, live.frame0,
+                                   live.frame0_delay_ms);
+          live.frame0 = NULL;
+        }
+      } else {
+        gfx_decode_begin(&live, &next, true);
+      }
+      // Switched to or not, what's standing by is no use any more
+      gfx_decode_drop(&standby, GFX_READER_STANDBY);
+      if (!next.park && !next.hold) {
+        gfx_decode_drop(&parked, GFX_READER_PARKED);
+      }
+    }
+
+    const uint8_t want = atomic_exchange(&_state->standby_slot, 0);
+    if (want) standby_slot = want;
+
+    frame_ring_slot_t *f = (live.active || live.primed)
+                               ? frame_ring_write_slot(&_state->ring)
+                               : NULL;
+    if (!f) {
+      // Done reading the buffer unless we're just waiting for room
+      if (!live.active && !live.primed) gfx_unpin(GFX_READER_DECODE);
+      if (standby_slot && _state->standby.pixels) {
+        // Nothing better to do until the ring has room
+        gfx_decode_drop(&standby, GFX_READER_STANDBY);
+        gfx_standby_prepare(&standby, standby_slot);
+        standby_slot = 0;
+        continue;
+      }
+      // Wait for room in the ring or a new job
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    if (live.primed) {
+      // Switch by swapping buffers, the ring gets the standby frame
+      uint8_t *spare = f->pixels;
+      *f = _state->standby;
+      _state->standby.pixels = spare;
+      f->epoch = live.job.epoch;
+      f->primed = true;
+      live.primed = false;
+    } else {
+      gfx_decode_next(&live, f);
+    }
+
+    frame_ring_push(&_state->ring);
+    xTaskNotifyGive(_state->task);
+  }
+}
+
+// Smallest bucket holding at least pct percent of the samples
+static uint32_t late_percentile(uint32_t total, uint32_t pct) {
+  uint32_t want = (total * pct + 99) / 100, seen = 0;
+  for (uint32_t i = 0; i < GFX_LATE_BUCKETS; i++) {
+    seen += _state->late_hist[i];
+    if (seen >= want) return i;
+  }
+  return GFX_LATE_BUCKETS - 1;
+}
+
+void gfx_get_stats(gfx_stats_t *out) {
+  if (!out) return;
+  *out = _state->stats;
+  out->decode_us_avg =
+      out->decoded ? _state->decode_us_total / out->decoded : 0;
+  out->present_us_avg =
+      out->presented ? _state->present_us_total / out->presented : 0;
+  out->cmd_latency_us_avg =
+      out->cmd_handled ? _state->cmd_us_total / out->cmd_handled : 0;
+  out->switch_us_avg =
+      out->switches ? _state->switch_us_total / out->switches : 0;
+  out->late_p50_ms = late_percentile(out->presented, 50);
+  out->late_p99_ms = late_percentile(out->presented, 99);
+}
+
 static bool validate_webp_decode(const uint8_t *data, size_t len) {
   int width = 0, height = 0;
   // returns 0 on failure (invalid WebP), non‑zero on success
@@ -565,7 +2015,7 @@ static bool validate_webp_signature(const uint8_t *data, size_t len) {
 }
 
 static inline int webp_decoder_init(webp_decoder_t *d, const uint8_t *buf,
-                                    size_t len) {
+                                    size_t len, bool cache) {
   // Ensure we don't mangle existing buffer?
   // Or where should this be?
   webp_decoder_deinit(d);
@@ -597,24 +2047,71 @@ static inline int webp_decoder_init(webp_decoder_t *d, const uint8_t *buf,
   d->last_ts = 0;
   d->frame_idx = 0;
   d->loop_count = 0;
+  d->prev_dispose = false;
+  d->replaying = false;
+  if (cache) webp_decoder_init_cache(d);
   return 0;
 }
 
+// Anything that plays more than once gets its first loop cached. The
+// standby decoder starts it on the switch, with frame 0 decoded already.
+static inline void webp_decoder_init_cache(webp_decoder_t *d) {
+  if (d->info.frame_count > 1 && d->info.loop_count != 1) {
+    frame_cache_init(&d->cache, d->info.canvas_width, d->info.canvas_height,
+                     d->info.frame_count);
+  }
+}
+
+// A loop just ended, false once we've played as many as the file asks
+static inline bool webp_decoder_end_loop(webp_decoder_t *d) {
+  d->loop_count++;
+  d->frame_idx = 0;
+  if (d->info.loop_count > 0 && d->loop_count >= d->info.loop_count) {
+    ESP_LOGI(TAG, "webp_decoder_next_frame: loop_count %lu reached limit %lu",
+             d->loop_count, d->info.loop_count);
+    return false;
+  }
+  return true;
+}
+
 static inline bool webp_decoder_next_frame(webp_decoder_t *d,
                                            uint8_t **out_pixels,
-                                           int *out_delay_ms) {
+                                           int *out_delay_ms,
+                                           bool *out_cached) {
+  *out_cached = false;
+  if (d->replaying && !frame_cache_ready(&d->cache) &&
+      d->frame_idx >= d->cache.filled) {
+    // Caught up with the decoder after a seek back, decode from here on
+    d->replaying = false;
+  }
+  if (d->replaying) {
+    if (d->frame_idx >= d->cache.frame_count && !webp_decoder_end_loop(d)) {
+      return false;
+    }
+    frame_cache_entry_t entry;
+    *out_pixels = (uint8_t *)frame_cache_load(&d->cache, d->frame_idx, &entry);
+    *out_delay_ms = (entry.delay_ms > 0 ? entry.delay_ms : 1);
+    d->dirty_y0 = entry.dirty_y0;
+    d->dirty_y1 = entry.dirty_y1;
+    d->frame_idx++;
+    *out_cached = true;
+    return *out_pixels != NULL;
+  }
+
   int ts;
   if (!WebPAnimDecoderGetNext(d->dec, out_pixels, &ts)) {
     // end of one cycle
-    d->loop_count++;
-    if (d->info.loop_count > 0 && d->loop_count >= d->info.loop_count) {
-      ESP_LOGI(TAG, "webp_decoder_next_frame: loop_count %lu reached limit %lu",
-               d->loop_count, d->info.loop_count);
+    if (!webp_decoder_end_loop(d)) {
       return false;
     }
+    // Replay from the cache from here on, libwebp stays untouched
+    if (frame_cache_ready(&d->cache)) {
+      ESP_LOGD(TAG, "webp_decoder_next_frame: replaying from cache");
+      d->replaying = true;
+      return webp_decoder_next_frame(d, out_pixels, out_delay_ms, out_cached);
+    }
     WebPAnimDecoderReset(d->dec);
     d->last_ts = 0;
-    d->frame_idx = 0;
     if (!WebPAnimDecoderGetNext(d->dec, out_pixels, &ts)) {
       ESP_LOGE(TAG, "webp_decoder_next_frame: GetNext failed after reset");
       return false;
@@ -624,12 +2121,60 @@ static inline bool webp_decoder_next_frame(webp_decoder_t *d,
   *out_delay_ms = (dt > 0 ? dt : 1);
   d->last_ts = ts;
   d->frame_idx++;
+  webp_decoder_dirty_rows(d);
   return true;
 }
 
+// Offer a freshly decoded frame to the cache
+static inline void webp_decoder_cache_frame(webp_decoder_t *d,
+                                            const uint8_t *pixels,
+                                            int delay_ms) {
+  if (!d->cache.data) return;
+  frame_cache_entry_t entry = {
+      .delay_ms = MIN(delay_ms, UINT16_MAX),
+      .dirty_y0 = d->dirty_y0,
+      .dirty_y1 = d->dirty_y1,
+  };
+  frame_cache_store(&d->cache, d->frame_idx - 1, pixels, &entry);
+}
+
+// Work out which canvas rows the frame just decoded can have touched: its
+// own ANMF rect, plus the previous rect if that one was disposed to
+// background. The first frame of a loop starts from a cleared canvas.
+static void webp_decoder_dirty_rows(webp_decoder_t *d) {
+  const int h = d->info.canvas_height;
+  int y0 = 0, y1 = h;
+  bool dispose = false;
+
+  WebPIterator iter;
+  const WebPDemuxer *dmux = WebPAnimDecoderGetDemuxer(d->dec);
+  if (dmux && WebPDemuxGetFrame(dmux, d->frame_idx, &iter)) {
+    y0 = iter.y_offset;
+    y1 = iter.y_offset + iter.height;
+    dispose = iter.dispose_method == WEBP_MUX_DISPOSE_BACKGROUND;
+    WebPDemuxReleaseIterator(&iter);
+  }
+
+  if (d->frame_idx == 1) {
+    d->dirty_y0 = 0;
+    d->dirty_y1 = h;
+  } else if (d->prev_dispose) {
+    d->dirty_y0 = MIN(y0, d->prev_y0);
+    d->dirty_y1 = MAX(y1, d->prev_y1);
+  } else {
+    d->dirty_y0 = y0;
+    d->dirty_y1 = y1;
+  }
+  d->prev_y0 = y0;
+  d->prev_y1 = y1;
+  d->prev_dispose = dispose;
+}
+
 static inline void webp_decoder_deinit(webp_decoder_t *d) {
   if (d->dec) {
     WebPAnimDecoderDelete(d->dec);
     d->dec = NULL;
   }
+  frame_cache_free(&d->cache);
+  d->replaying = false;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <esp_log.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -10,6 +11,7 @@
 typedef struct webp_meta {
   uint8_t dwell_secs;    // Seconds to dwell on this image
   uint8_t palette_mode;  // Palette/transform mode
+  uint32_t app_id;       // Which app rendered it, 0 if the server didn't say
 } webp_meta_t;
 
 // Full image slot containing data and metadata
@@ -18,6 +20,9 @@ typedef struct webp_item {
   size_t len;        // Actual length of data
   size_t size;       // Allocated size of buffer
   webp_meta_t meta;  // Associated metadata
+  bool borrowed;     // buf is read only (flash asset), never freed or reused
+  uint32_t fetched;  // Arrival order, the rotation evicts the oldest
+  uint32_t crc;      // CRC32 of buf, spots fetches that changed nothing
 } webp_item_t;
 
 // GFX Initialization and teardown
@@ -33,10 +38,78 @@ int gfx_set_palette(uint8_t slot, gfx_palette_t palette);
 // WebP updates
 int gfx_update(const void* webp, size_t len,
                const webp_meta_t*
-                   meta);  // copies WebP to slot 1 // Caller must free buffer!
+                   meta);  // copies WebP into the rotation and shows it now
+                           // Caller must free buffer!
+// Zero copy variants: on success the slot adopts webp (a mem_pool buffer) and
+// its previous buffer goes back to the pool. They only fail if webp wasn't
+// adopted, in which case the caller keeps it.
+uint8_t gfx_update_slot_take(uint8_t slot, uint8_t* webp, size_t len,
+                             const webp_meta_t* meta);
+
+// Rotation: the app slots play in turn, each for its meta.dwell_secs. How
+// many apps it keeps follows the memory there is for them (see
+// GFX_ROTATION_BUDGET), the least recently fetched make way for new ones.
+// Plays when its turn comes, straight away if nothing is rotating yet.
+// Bytes the rotation already holds only refresh that app's dwell, webp is
+// freed and nothing restarts. A new render of an app (same meta->app_id)
+// replaces the old one in its slot. Without an app_id apps can't be told
+// apart, so webp becomes the only app in the rotation.
+int gfx_rotation_take(uint8_t* webp, size_t len, const webp_meta_t* meta);
+// The last image taken was fetched again unchanged (HTTP 304), refresh it
+// like a duplicate. Found by meta->app_id when there is one, else as the
+// last body taken. Fails if it has left the rotation since.
+int gfx_rotation_refresh(const webp_meta_t* meta);
+// The next app would push one out, so fetches only refresh. Never true for
+// a single slot rotation, that one is always due.
+bool gfx_rotation_full(void);
 int gfx_draw_buffer(const void* buf, size_t len);
+// Takes the display for secs, then the app it interrupted carries on from
+// the frame it was on with the dwell it had left. Draws posted meanwhile
+// wait their turn. buf must stay valid until the alert is over.
+int gfx_show_alert(const void* buf, size_t len, uint32_t secs);
+// Puts a partial image from a download in progress on the panel, rgbA at
+// most panel sized. Fails while the rotation is playing. The finished body
+// replaces it through gfx_rotation_take, gfx_cancel_preview puts back what
+// was drawn before if it never comes. One caller at a time.
+int gfx_show_preview(const uint8_t* rgba, uint16_t width, uint16_t height);
+void gfx_cancel_preview(void);
 
 // Visual helpers
 int gfx_clear(void);
+// Brightness in percent, applied by the present stage, which redraws what
+// the change cleared off the panel
+int gfx_set_brightness(uint8_t pct);
 int gfx_show_ota(uint8_t pct);
 void cycle_display_palette(void);  // Cycle palette mode on the current slot
+
+// Render pipeline counters and stage timings
+typedef struct gfx_stats {
+  uint32_t decoded;    // Frames produced by the decode stage
+  uint32_t presented;  // Frames handed to the display
+  uint32_t underruns;  // Frames that weren't decoded by the time they were due
+  uint32_t stale;      // Decoded frames dropped because the image changed
+  uint32_t skipped;    // Frames that were due so late they weren't drawn
+  uint32_t resyncs;    // Times we fell too far behind and restarted timing
+  uint32_t errors;     // Images that failed to decode
+  uint32_t dedupe_hits;    // Fetches identical to an app we already had
+  uint32_t dedupe_misses;  // ... and ones that were new
+  size_t dedupe_bytes;     // Bytes the hits didn't copy or decode
+  uint32_t cmd_posted;     // Commands sent to the present stage
+  uint32_t cmd_handled;    // ... that it acted on
+  uint32_t cmd_coalesced;  // ... dropped, superseded before it got to them
+  uint32_t cmd_depth_max;  // Most commands pending at once
+  uint32_t cmd_latency_us_avg, cmd_latency_us_max;  // Posted to handled
+  uint32_t switches;         // Images put up by a draw command
+  uint32_t switches_primed;  // ... whose first frame was decoded ahead
+  uint32_t switch_us_avg, switch_us_max;  // Command handled to on screen
+  uint32_t decode_us_avg, decode_us_max;
+  uint32_t present_us_avg, present_us_max;
+  uint32_t late_p50_ms, late_p99_ms;  // How late frames went up
+} gfx_stats_t;
+
+void gfx_get_stats(gfx_stats_t* out);
+
+#ifdef GFX_SLOT_STRESS
+// Concurrent slot writers against the live pipeline, logs the verdict
+void gfx_slot_stress(const void* webp, size_t len, uint32_t secs);
+#endif
@@ -1,11 +1,25 @@
 #include "gfx_palette.h"
 
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "dspm_mult.h"
+#include "sdkconfig.h"
 #include "util.h"
 
+// Run the compiled palettes through esp-dsp's int16 matrix multiply, which
+// uses the S3's vector (PIE) instructions
+#ifndef GFX_PALETTE_DSP
+#if CONFIG_IDF_TARGET_ESP32S3
+#define GFX_PALETTE_DSP 1
+#else
+#define GFX_PALETTE_DSP 0
+#endif
+#endif
+
 static const char *TAG = "gfx_p";
 
 static const float MATRIX_IDENTITY[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
@@ -127,6 +141,114 @@ const float (*gfx_palette_matrix(gfx_palette_t mode))[3] {
   }
 }
 
+void gfx_palette_compile(const float matrix[3][3], gfx_palette_q_t *out) {
+  const float *m = (const float *)matrix;
+  bool identity = true;
+  for (int i = 0; i < 9; i++) {
+    float v = m[i] * (float)(1 << GFX_PALETTE_Q);
+    v = MIN(MAX(v, (float)INT16_MIN), (float)INT16_MAX);
+    out->m[i / 3][i % 3] = (int16_t)lroundf(v);
+    identity &= m[i] == (i % 4 == 0 ? 1.0f : 0.0f);
+  }
+  out->identity = identity;
+}
+
+const gfx_palette_q_t *gfx_palette_q(gfx_palette_t mode) {
+  static gfx_palette_q_t compiled[PALETTE_COUNT];
+  static bool valid[PALETTE_COUNT];
+
+  if (mode >= PALETTE_COUNT) mode = PALETTE_NORMAL;
+  if (!valid[mode]) {
+    gfx_palette_compile(gfx_palette_matrix(mode), &compiled[mode]);
+    valid[mode] = true;
+  }
+  return &compiled[mode];
+}
+
+static void apply_q_scalar(uint8_t *p, size_t npix, const gfx_palette_q_t *q) {
+  for (size_t i = 0; i < npix; i++, p += 4) {
+    // Skip alpha
+    gfx_palette_px_q(q, &p[0], &p[1], &p[2]);
+  }
+}
+
+#if GFX_PALETTE_DSP
+// Pixels per dspm call, deinterleaved into R, G and B planes plus a plane of
+// ones, so the multiply is 4x4 x 4xN, a shape the vector kernels handle
+#define DSP_CHUNK 64
+// dspm_mult_s16 computes (A x B + (0x7fff >> shift)) >> (15 - shift)
+#define DSP_SHIFT (15 - GFX_PALETTE_Q)
+#define DSP_ROUNDING (0x7fff >> DSP_SHIFT)
+
+static int16_t _dsp_in[4 * DSP_CHUNK] __attribute__((aligned(16)));
+static int16_t _dsp_out[4 * DSP_CHUNK] __attribute__((aligned(16)));
+static int _dsp_state;  // 0 untested, 1 good, -1 disabled
+
+static void apply_q_dsp(uint8_t *pix, size_t npix, const gfx_palette_q_t *q) {
+  // The ones plane times -DSP_ROUNDING cancels dspm's rounding, leaving the
+  // same floor as the scalar kernel
+  int16_t a[16] __attribute__((aligned(16))) = {0};
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      a[i * 4 + j] = q->m[i][j];
+    }
+    a[i * 4 + 3] = -DSP_ROUNDING;
+  }
+  for (int i = 0; i < DSP_CHUNK; i++) {
+    _dsp_in[3 * DSP_CHUNK + i] = 1;
+  }
+
+  for (size_t off = 0; off < npix; off += DSP_CHUNK) {
+    const size_t n = MIN((size_t)DSP_CHUNK, npix - off);
+    uint8_t *p = pix + off * 4;
+    for (size_t i = 0; i < n; i++) {
+      _dsp_in[i] = p[i * 4 + 0];
+      _dsp_in[DSP_CHUNK + i] = p[i * 4 + 1];
+      _dsp_in[2 * DSP_CHUNK + i] = p[i * 4 + 2];
+    }
+    dspm_mult_s16(a, _dsp_in, _dsp_out, 4, 4, DSP_CHUNK, DSP_SHIFT);
+    for (size_t i = 0; i < n; i++) {
+      p[i * 4 + 0] = (uint8_t)MIN(MAX(_dsp_out[i], 0), 255);
+      p[i * 4 + 1] = (uint8_t)MIN(MAX(_dsp_out[DSP_CHUNK + i], 0), 255);
+      p[i * 4 + 2] = (uint8_t)MIN(MAX(_dsp_out[2 * DSP_CHUNK + i], 0), 255);
+    }
+  }
+}
+
+// Check once that the DSP path matches the scalar kernel bit for bit before
+// trusting it with frames, fall back to scalar otherwise.
+static bool dsp_usable(const gfx_palette_q_t *q) {
+  if (_dsp_state == 0) {
+    uint8_t a[DSP_CHUNK * 4], b[DSP_CHUNK * 4];
+    for (int i = 0; i < DSP_CHUNK * 4; i++) {
+      a[i] = b[i] = (uint8_t)(i * 37 + 11);
+    }
+    apply_q_scalar(a, DSP_CHUNK, q);
+    apply_q_dsp(b, DSP_CHUNK, q);
+    _dsp_state = memcmp(a, b, sizeof(a)) == 0 ? 1 : -1;
+    if (_dsp_state < 0) {
+      ESP_LOGW(TAG, "DSP palette kernel disagrees with scalar, not using it");
+    }
+  }
+  return _dsp_state > 0;
+}
+#endif
+
+void gfx_palette_apply_q(uint8_t *pix, size_t npix, const gfx_palette_q_t *q) {
+  if (!pix || !q) {
+    ESP_LOGW(TAG, "gfx_palette_apply_q: Invalid buffer/palette passed");
+    return;
+  }
+  if (q->identity) return;
+#if GFX_PALETTE_DSP
+  if (dsp_usable(q)) {
+    apply_q_dsp(pix, npix, q);
+    return;
+  }
+#endif
+  apply_q_scalar(pix, npix, q);
+}
+
 void gfx_palette_apply(uint8_t *pix, int w, int h, const float matrix[3][3]) {
   if (!pix || !matrix) {
     ESP_LOGW(TAG, "gfx_palette_apply: Invalid buffer/matrix passed");
@@ -210,53 +332,74 @@ void gfx_palette_apply_frame_rbg(uint8_t *pix, int w, int h,
   }
 }
 
+// Whole frame in one go. This used to stage the frame through two malloc'd
+// float planes for dspm_mult_f32, the fixed point kernel needs neither.
 void gfx_palette_apply_frame(uint8_t *pix, int w, int h,
                              const float matrix3x3[3][3]) {
-  const int channels = 4;  // RGBA
-  const int npix = w * h;
-
-  // Allocate temp float arrays (size 3 x npix)
-  float *input = (float *)malloc(sizeof(float) * 3 * npix);
-  float *output = (float *)malloc(sizeof(float) * 3 * npix);
+  gfx_palette_q_t q;
+  gfx_palette_compile(matrix3x3, &q);
+  gfx_palette_apply_q(pix, (size_t)w * h, &q);
+}
 
-  if (!input || !output) {
-    ESP_LOGE("gfx", "Failed to allocate memory for batch palette apply!");
-    if (input) free(input);
-    if (output) free(output);
+#ifdef GFX_PALETTE_BENCHMARK
+// Sweep the RGB cube a frame at a time through both kernels
+#define BENCH_W 64
+#define BENCH_H 32
+#define BENCH_STRIDE 31
+
+void gfx_palette_benchmark(void) {
+  const size_t npix = BENCH_W * BENCH_H;
+  uint8_t *ref = malloc(npix * 4);
+  uint8_t *fix = malloc(npix * 4);
+  if (!ref || !fix) {
+    ESP_LOGE(TAG, "benchmark: no memory");
+    free(ref);
+    free(fix);
     return;
   }
 
-  // Load pixel data into input buffer
-  for (int i = 0; i < npix; i++) {
-    input[i + 0 * npix] = pix[i * channels + 0];  // R
-    input[i + 1 * npix] = pix[i * channels + 1];  // G
-    input[i + 2 * npix] = pix[i * channels + 2];  // B
-                                                  // Skip Alpha (leave it as is)
-  }
-
-  // Single DSP matrix multiply: (3x3) × (3 x npix)
-  dspm_mult_f32((float *)matrix3x3, input, output, 3, 3, npix);
-
-  // Write results back to pixel buffer
-  for (int i = 0; i < npix; i++) {
-    pix[i * channels + 0] = (output[i + 0 * npix] > 255.0f) ? 255
-                            : (output[i + 0 * npix] < 0.0f)
-                                ? 0
-                                : (uint8_t)output[i + 0 * npix];
-    pix[i * channels + 1] = (output[i + 1 * npix] > 255.0f) ? 255
-                            : (output[i + 1 * npix] < 0.0f)
-                                ? 0
-                                : (uint8_t)output[i + 1 * npix];
-    pix[i * channels + 2] = (output[i + 2 * npix] > 255.0f) ? 255
-                            : (output[i + 2 * npix] < 0.0f)
-                                ? 0
-                                : (uint8_t)output[i + 2 * npix];
-    // Alpha untouched
+  for (int mode = PALETTE_NORMAL + 1; mode < PALETTE_COUNT; mode++) {
+    const float (*matrix)[3] = gfx_palette_matrix(mode);
+    const gfx_palette_q_t *q = gfx_palette_q(mode);
+    uint32_t exact = 0, total = 0, max_dev = 0, frames = 0;
+    int64_t us_float = 0, us_fixed = 0;
+
+    for (uint32_t base = 0; base < (1u << 24); base += npix * BENCH_STRIDE) {
+      for (size_t i = 0; i < npix; i++) {
+        uint32_t v = (base + i * BENCH_STRIDE) & 0xFFFFFF;
+        ref[i * 4 + 0] = fix[i * 4 + 0] = v >> 16;
+        ref[i * 4 + 1] = fix[i * 4 + 1] = v >> 8;
+        ref[i * 4 + 2] = fix[i * 4 + 2] = v;
+        ref[i * 4 + 3] = fix[i * 4 + 3] = 0xFF;
+      }
+      int64_t t0 = esp_timer_get_time();
+      gfx_palette_apply(ref, BENCH_W, BENCH_H, matrix);
+      int64_t t1 = esp_timer_get_time();
+      gfx_palette_apply_q(fix, npix, q);
+      int64_t t2 = esp_timer_get_time();
+      us_float += t1 - t0;
+      us_fixed += t2 - t1;
+      frames++;
+
+      for (size_t i = 0; i < npix * 4; i++) {
+        uint32_t dev = abs(ref[i] - fix[i]);
+        exact += dev == 0;
+        max_dev = MAX(max_dev, dev);
+        total++;
+      }
+    }
+
+    ESP_LOGI(TAG,
+             "bench %-9s exact %5.2f%% max dev %lu | float %lld us fixed %lld "
+             "us per frame",
+             gfx_palette_name(mode), 100.0f * exact / total, max_dev,
+             us_float / frames, us_fixed / frames);
   }
 
-  free(input);
-  free(output);
+  free(ref);
+  free(fix);
 }
+#endif
 
 // static void apply_night_matrix(uint8_t *pix, int w, int h) {
 //   // const float M[3][3] = {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -22,12 +24,53 @@ typedef enum {
   PALETTE_COUNT
 } gfx_palette_t;
 
+// Fractional bits of the compiled coefficients. Q14 holds every matrix we
+// ship (|coef| < 2) in an int16, which is what the S3 DSP kernel wants.
+#define GFX_PALETTE_Q 14
+
+// A palette matrix compiled to fixed point
+typedef struct gfx_palette_q {
+  int16_t m[3][3];
+  bool identity;  // Nothing to do
+} gfx_palette_q_t;
+
 const char *gfx_palette_name(gfx_palette_t mode);
 const float (*gfx_palette_matrix(gfx_palette_t mode))[3];
+
+// Arithmetic shift floors, which is what the float cast does for the
+// positive values we keep
+static inline uint8_t gfx_palette_clamp_q(int32_t v) {
+  v >>= GFX_PALETTE_Q;
+  return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+// One pixel through a compiled palette, shared by every integer kernel so
+// they agree bit for bit
+static inline void gfx_palette_px_q(const gfx_palette_q_t *q, uint8_t *r,
+                                    uint8_t *g, uint8_t *b) {
+  const int16_t *m = &q->m[0][0];
+  int32_t ir = *r, ig = *g, ib = *b;
+  *r = gfx_palette_clamp_q(m[0] * ir + m[1] * ig + m[2] * ib);
+  *g = gfx_palette_clamp_q(m[3] * ir + m[4] * ig + m[5] * ib);
+  *b = gfx_palette_clamp_q(m[6] * ir + m[7] * ig + m[8] * ib);
+}
+
+// Compiled (and cached) fixed point form of a palette
+const gfx_palette_q_t *gfx_palette_q(gfx_palette_t mode);
+void gfx_palette_compile(const float matrix[3][3], gfx_palette_q_t *out);
+// Integer kernel over npix RGBA pixels. Within 1 LSB of the float path.
+void gfx_palette_apply_q(uint8_t *pix, size_t npix, const gfx_palette_q_t *q);
+
+// Float kernels, gfx_palette_apply is the reference for the integer one
 void gfx_palette_apply(uint8_t *pix, int w, int h, const float matrix[3][3]);
 void gfx_palette_apply_frame(uint8_t *pix, int w, int h, const float matrix[3][3]);
 void gfx_palette_apply_frame_rbg(uint8_t *pix, int w, int h, const float matrix[3][3]);
 
+#ifdef GFX_PALETTE_BENCHMARK
+// Check the fixed point kernels against the float one and time both
+void gfx_palette_benchmark(void);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -1,4 +1,3 @@
-#include <assets.h>
 #include <esp_log.h>
 #include <esp_netif.h>
 #include <freertos/FreeRTOS.h>
@@ -6,12 +5,15 @@
 #include <freertos/timers.h>
 #include <webp/demux.h>
 
+#include "asset_store.h"
 #include "audio.h"
 #include "build_info.h"  // generated
+#include "content_cache.h"
 #include "display.h"
 #include "driver/gpio.h"
 #include "flash.h"
 #include "gfx.h"
+#include "mem_pool.h"
 #include "ota_server.h"
 #include "pinsmap.h"
 #include "remote.h"
@@ -23,6 +25,11 @@
 
 static const char* TAG = "main";
 #define MIN_FETCH_INTERVAL 2  // Don't hammer the server.
+// Once the rotation holds all it can, refresh one app this often instead of
+// one fetch per app shown
+#ifndef ROTATION_REFRESH_SECS
+#define ROTATION_REFRESH_SECS 30
+#endif
 
 #ifndef DEFAULT_TIMEZONE
 DEFAULT_TIMEZONE = "America/New_York"
@@ -52,7 +59,7 @@ DEFAULT_TIMEZONE = "America/New_York"
     else
       _brightness_pct = 100;
 
-    display_set_brightness(_brightness_pct);
+    gfx_set_brightness(_brightness_pct);
     vTaskDelay(pdMS_TO_TICKS(200));  // debounce
   }
 
@@ -64,7 +71,7 @@ DEFAULT_TIMEZONE = "America/New_York"
     else
       _brightness_pct = 0;
 
-    display_set_brightness(_brightness_pct);
+    gfx_set_brightness(_brightness_pct);
     vTaskDelay(pdMS_TO_TICKS(200));  // debounce
   }
 
@@ -125,12 +132,31 @@ void app_main(void) {
   }
   esp_register_shutdown_handler(&flash_shutdown);
 
+  // Come back to the last image we were sent, else the "no apps" screen.
+  // The first fetch takes over.
+  const uint8_t* boot_webp = NULL;
+  size_t boot_len = 0;
+  webp_meta_t boot_meta = {0};
+  if (asset_store_init() == 0) {
+    boot_webp = asset_store_get("noapps", &boot_len);
+  } else {
+    // Partition tables don't change over the air
+    ESP_LOGW(TAG, "no boot screen until flashed over USB");
+  }
+  if (content_cache_init() == 0 &&
+      content_cache_boot(&boot_webp, &boot_len, &boot_meta)) {
+    ESP_LOGI(TAG, "booting into cached image (%zu bytes)", boot_len);
+  }
+
   // Setup the display.
-  if (gfx_initialize(ASSET_NOAPPS_WEBP, ASSET_NOAPPS_WEBP_LEN)) {
+  if (gfx_initialize(boot_webp, boot_len)) {
     ESP_LOGE(TAG, "failed to initialize gfx");
     return;
   }
   esp_register_shutdown_handler(&display_shutdown);
+  if (boot_meta.palette_mode) {
+    gfx_set_palette(0, boot_meta.palette_mode);
+  }
 
   // Setup WiFi.
   if (wifi_initialize(WIFI_SSID, WIFI_PASSWORD)) {
@@ -167,6 +193,14 @@ void app_main(void) {
 
   time_start_sync_task(DEFAULT_TIMEZONE);
 
+  // Reserve the image arenas once WiFi and TLS have taken what they need
+  if (mem_pool_init()) {
+    ESP_LOGW(TAG, "no memory pool, images will use the heap");
+  }
+#ifdef GFX_SLOT_STRESS
+  if (boot_webp) gfx_slot_stress(boot_webp, boot_len, 30);
+#endif
+
   // Play a sample. This will only have an effect on Gen 2 devices.
   // audio_play(ASSET_LAZY_DADDY_MP3, ASSET_LAZY_DADDY_MP3_LEN);
 #ifdef TIXEL
@@ -217,34 +251,70 @@ void app_main(void) {
 
     // timer expiry: remote fetch -> update buffer dance
     {
+      // remote_get allocates the body, gfx takes it over
       uint8_t* webp = NULL;
       size_t len = 0;
       uint8_t dwell_secs = MIN_FETCH_INTERVAL;
       static uint8_t brightness = DISPLAY_DEFAULT_BRIGHTNESS;
       uint8_t palette = 0;
-
-      if (remote_get(REMOTE_URL, &webp, &len, &brightness, &dwell_secs,
-                     &palette) == 0) {
-        display_set_brightness(brightness);
+      uint32_t app_id = 0;
+      static uint32_t fetches = 0;
+
+      int rc = remote_get(REMOTE_URL, &webp, &len, &brightness, &dwell_secs,
+                          &palette, &app_id);
+      if (rc == REMOTE_NOT_MODIFIED) {
+        // Same app as last time, only its dwell and palette are news
+        webp_meta_t meta = {
+            .dwell_secs = MAX(dwell_secs, MIN_FETCH_INTERVAL),
+            .palette_mode = palette,
+            .app_id = app_id,
+        };
+        gfx_set_brightness(brightness);
+        if (brightness && gfx_rotation_refresh(&meta) != 0) {
+          // The rotation has let it go since, fetch it whole after all
+          remote_forget();
+          rc = remote_get(REMOTE_URL, &webp, &len, &brightness, &dwell_secs,
+                          &palette, &app_id);
+        }
+      }
+      if (rc == 0) {
+        gfx_set_brightness(brightness);
         if (webp && len && brightness) {
           webp_meta_t meta = {
-              .dwell_secs = dwell_secs,
+              // Zero would hold the rotation on this app forever
+              .dwell_secs = MAX(dwell_secs, MIN_FETCH_INTERVAL),
               .palette_mode = palette,
+              .app_id = app_id,
           };
           ESP_LOGI(TAG, "Updated webp (%zu bytes)", len);
-          gfx_update(webp, len, &meta);
+          content_cache_store(webp, len, &meta);
+          if (gfx_rotation_take(webp, len, &meta) == 0) {
+            webp = NULL;  // gfx owns it now
+          } else {
+            remote_forget();  // A 304 would refresh an older body
+          }
         } else {
           ESP_LOGI(TAG, "Skipping draw of webp (%zu bytes) brightness: %d", len,
                    brightness);
+          gfx_cancel_preview();
+          remote_forget();  // Not in the rotation, fetch it whole next time
         }
-        free(webp);
-      } else {
+        mem_pool_free(webp);
+      } else if (rc != REMOTE_NOT_MODIFIED) {
         ESP_LOGE(TAG, "Failed to fetch WebP");
         dwell_secs = MIN_FETCH_INTERVAL;
       }
+      if (++fetches % 16 == 0) {
+        mem_pool_log_stats();
+      }
 
-      // schedule next wakeup: max(dwell, MIN_FETCH_INTERVAL)
-      uint32_t ms = MAX((uint32_t)dwell_secs, MIN_FETCH_INTERVAL) * 1000;
+      // schedule next wakeup: max(dwell, MIN_FETCH_INTERVAL), slower once
+      // the rotation plays from what it has
+      uint32_t secs = MAX((uint32_t)dwell_secs, MIN_FETCH_INTERVAL);
+      if (gfx_rotation_full()) {
+        secs = MAX(secs, ROTATION_REFRESH_SECS);
+      }
+      uint32_t ms = secs * 1000;
       nextDelay = pdMS_TO_TICKS(ms);
       ESP_LOGI(TAG, "Next fetch in %lu ms", ms);
     }
@@ -0,0 +1,250 @@
+#include "mem_pool.h"
+
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "frame_cache.h"
+#include "remote.h"
+#include "sdkconfig.h"
+#include "util.h"
+
+static const char *TAG = "mem_pool";
+
+// Internal heap we leave alone when reserving, WiFi and TLS live there
+#ifndef MEM_POOL_HEAP_HEADROOM
+#define MEM_POOL_HEAP_HEADROOM (64 * 1024)
+#endif
+
+// Same for PSRAM, large mallocs go there once it's set up
+#ifndef MEM_POOL_SPIRAM_HEADROOM
+#define MEM_POOL_SPIRAM_HEADROOM (256 * 1024)
+#endif
+
+// Without PSRAM every block is internal RAM. Bodies and decoder working
+// memory share the large class: the body coming in, the one in the
+// rotation and one a reader still pins. The defaults reserve about 150 KB,
+// fewer blocks leave more heap to WiFi and TLS at the cost of fallbacks.
+#ifndef MEM_POOL_LARGE_BLOCKS
+#define MEM_POOL_LARGE_BLOCKS 3
+#endif
+#ifndef MEM_POOL_CANVAS_BLOCKS
+#define MEM_POOL_CANVAS_BLOCKS 4
+#endif
+#define MEM_POOL_LARGE_SIZE MAX(32768, HTTP_BUFFER_SIZE_MAX)
+
+typedef struct {
+  size_t size;     // Block size
+  uint16_t count;  // Blocks wanted
+  bool spiram;     // Prefer PSRAM, decode hot classes stay internal
+  bool bulk;       // Images kept around, see mem_pool_alloc_bulk()
+} pool_class_cfg_t;
+
+// Smallest first. A request takes the smallest class with a free block,
+// from its own family first.
+static const pool_class_cfg_t _cfg[] = {
+#ifdef CONFIG_SPIRAM
+    {256, 64, false, false},   // libwebp bookkeeping
+    {2048, 16, false, false},  // Demux frames, row buffers
+    {8192, 8, false, false},   // 64x32 rgbA canvases
+    {16384, 24, true, true},   // App images, most are small
+    {32768, 6, false, false},  // VP8/VP8L working memory
+    {65536, 8, true, true},
+    {131072, 3, true, true},
+    {HTTP_BUFFER_SIZE_MAX, 1, true, true},
+    {FRAME_CACHE_BUDGET, 1, true, false},
+#else
+    {256, 32, false, false},
+    {2048, 8, false, false},
+    {8192, MEM_POOL_CANVAS_BLOCKS, false, false},
+    // Bodies too, HTTP_BUFFER_SIZE_MAX is 30000 on Tixel
+    {MEM_POOL_LARGE_SIZE, MEM_POOL_LARGE_BLOCKS, false, false},
+#endif
+};
+#define POOL_CLASSES (sizeof(_cfg) / sizeof(_cfg[0]))
+
+typedef struct {
+  uint8_t *base;
+  size_t size;
+  bool bulk;
+  uint16_t count;  // Blocks actually reserved
+  uint16_t nfree;
+  uint16_t *free;  // Stack of free block indices
+  uint16_t high_water;
+} pool_class_t;
+
+static pool_class_t _classes[POOL_CLASSES];
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t _fallbacks, _reported_fallbacks;
+static size_t _fallback_bytes;
+
+static uint8_t *reserve(const pool_class_cfg_t *cfg, uint16_t *count) {
+  for (; *count > 0; (*count)--) {
+    const size_t bytes = cfg->size * *count;
+    uint8_t *p = NULL;
+#ifdef CONFIG_SPIRAM
+    if (cfg->spiram && heap_caps_get_free_size(MALLOC_CAP_SPIRAM) >=
+                           bytes + MEM_POOL_SPIRAM_HEADROOM) {
+      p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      if (p) return p;
+    }
+#endif
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) <
+        bytes + MEM_POOL_HEAP_HEADROOM) {
+      continue;
+    }
+    p = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (p) return p;
+  }
+  return NULL;
+}
+
+int mem_pool_init(void) {
+  size_t reserved = 0;
+  for (size_t i = 0; i < POOL_CLASSES; i++) {
+    pool_class_t *c = &_classes[i];
+    uint16_t count = _cfg[i].count;
+    uint16_t *free_idx = malloc(count * sizeof(*free_idx));
+    uint8_t *base = free_idx ? reserve(&_cfg[i], &count) : NULL;
+    if (!base) {
+      ESP_LOGW(TAG, "class %zu: could not reserve any blocks", _cfg[i].size);
+      free(free_idx);
+      continue;
+    }
+    if (count < _cfg[i].count) {
+      ESP_LOGW(TAG, "class %zu: only %u of %u blocks", _cfg[i].size, count,
+               _cfg[i].count);
+    }
+    for (uint16_t b = 0; b < count; b++) {
+      free_idx[b] = count - 1 - b;
+    }
+
+    taskENTER_CRITICAL(&_lock);
+    c->size = _cfg[i].size;
+    c->bulk = _cfg[i].bulk;
+    c->free = free_idx;
+    c->nfree = count;
+    c->count = count;
+    c->base = base;  // Last, mem_pool_free() looks at it without the lock
+    taskEXIT_CRITICAL(&_lock);
+    reserved += c->size * count;
+  }
+  ESP_LOGI(TAG, "reserved %zu bytes in %u classes, heap free %zu", reserved,
+           (unsigned)POOL_CLASSES, heap_caps_get_free_size(MALLOC_CAP_8BIT));
+  return reserved ? 0 : 1;
+}
+
+// Lock held
+static void *take(size_t size, bool bulk) {
+  for (size_t i = 0; i < POOL_CLASSES; i++) {
+    pool_class_t *c = &_classes[i];
+    if (c->bulk != bulk || c->size < size || c->nfree == 0) continue;
+    c->high_water = MAX(c->high_water, c->count - c->nfree + 1);
+    return c->base + c->free[--c->nfree] * c->size;
+  }
+  return NULL;
+}
+
+static void *pool_alloc(size_t size, bool bulk) {
+  void *p;
+  if (size == 0) size = 1;
+
+  taskENTER_CRITICAL(&_lock);
+  p = take(size, bulk);
+  if (!p) p = take(size, !bulk);
+  if (!p) {
+    _fallbacks++;
+    _fallback_bytes += size;
+  }
+  taskEXIT_CRITICAL(&_lock);
+
+  if (!p) {
+    ESP_LOGD(TAG, "no block for %zu bytes, using heap", size);
+    p = malloc(size);
+  }
+  return p;
+}
+
+void *mem_pool_alloc(size_t size) { return pool_alloc(size, false); }
+
+void *mem_pool_alloc_bulk(size_t size) { return pool_alloc(size, true); }
+
+void *mem_pool_try_alloc_bulk(size_t size) {
+  if (size == 0) size = 1;
+  taskENTER_CRITICAL(&_lock);
+  void *p = take(size, true);
+  if (!p) p = take(size, false);
+  taskEXIT_CRITICAL(&_lock);
+  return p;
+}
+
+void *mem_pool_calloc(size_t n, size_t size) {
+  if (size && n > SIZE_MAX / size) return NULL;
+  void *p = mem_pool_alloc(n * size);
+  if (p) memset(p, 0, n * size);
+  return p;
+}
+
+static pool_class_t *owner(const void *p) {
+  const uint8_t *b = p;
+  for (size_t i = 0; i < POOL_CLASSES; i++) {
+    pool_class_t *c = &_classes[i];
+    if (c->base && b >= c->base && b < c->base + c->size * c->count) {
+      return c;
+    }
+  }
+  return NULL;
+}
+
+void mem_pool_free(void *p) {
+  if (!p) return;
+  pool_class_t *c = owner(p);
+  if (!c) {
+    free(p);
+    return;
+  }
+  uint16_t idx = ((uint8_t *)p - c->base) / c->size;
+  taskENTER_CRITICAL(&_lock);
+  c->free[c->nfree++] = idx;
+  taskEXIT_CRITICAL(&_lock);
+}
+
+size_t mem_pool_capacity(const void *p) {
+  pool_class_t *c = p ? owner(p) : NULL;
+  return c ? c->size : 0;
+}
+
+void mem_pool_get_stats(mem_pool_stats_t *out) {
+  memset(out, 0, sizeof(*out));
+  taskENTER_CRITICAL(&_lock);
+  for (size_t i = 0; i < POOL_CLASSES; i++) {
+    const pool_class_t *c = &_classes[i];
+    out->reserved += c->size * c->count;
+    out->in_use += c->count - c->nfree;
+    out->high_water += c->high_water;
+  }
+  out->fallbacks = _fallbacks;
+  out->fallback_bytes = _fallback_bytes;
+  taskEXIT_CRITICAL(&_lock);
+  out->heap_free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  out->heap_min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+}
+
+void mem_pool_log_stats(void) {
+  mem_pool_stats_t s;
+  mem_pool_get_stats(&s);
+  for (size_t i = 0; i < POOL_CLASSES; i++) {
+    const pool_class_t *c = &_classes[i];
+    if (!c->count) continue;
+    ESP_LOGI(TAG, "class %6zu: %2u/%2u in use, high-water %2u", c->size,
+             c->count - c->nfree, c->count, c->high_water);
+  }
+  ESP_LOGI(TAG,
+           "heap fallbacks %lu (+%lu since last, %zu bytes total), heap free "
+           "%zu min %zu",
+           s.fallbacks, s.fallbacks - _reported_fallbacks, s.fallback_bytes,
+           s.heap_free, s.heap_min_free);
+  _reported_fallbacks = s.fallbacks;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+// Size classed block arenas, reserved once at boot so fetching, storing and
+// decoding images doesn't churn (and fragment) the heap. Requests the pool
+// can't serve fall back to the heap and are counted.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct mem_pool_stats {
+  uint32_t fallbacks;       // Allocations that went to the heap instead
+  size_t fallback_bytes;    // ... and their total size
+  size_t reserved;          // Bytes held by the arenas
+  uint32_t in_use;          // Blocks handed out right now
+  uint32_t high_water;      // Most blocks ever handed out at once
+  size_t heap_free;         // Free heap now
+  size_t heap_min_free;     // Lowest free heap since boot
+} mem_pool_stats_t;
+
+// Reserve the arenas. Anything allocated before this comes from the heap,
+// which is fine, mem_pool_free() tells the two apart.
+int mem_pool_init(void);
+
+void *mem_pool_alloc(size_t size);
+// For images that stay around (bodies, slots). Comes from the PSRAM classes
+// where there are any, leaving the internal ones to the decoder.
+void *mem_pool_alloc_bulk(size_t size);
+// Same, but NULL rather than the heap when no block is free. For copies
+// that can be skipped.
+void *mem_pool_try_alloc_bulk(size_t size);
+void *mem_pool_calloc(size_t n, size_t size);
+// Takes pool blocks and heap pointers alike
+void mem_pool_free(void *p);
+
+// Usable size of a pool block, 0 for anything else
+size_t mem_pool_capacity(const void *p);
+
+void mem_pool_get_stats(mem_pool_stats_t *out);
+// Per class high-water marks, and heap fallbacks since the last call
+void mem_pool_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,34 +4,115 @@
 #include <esp_http_client.h>
 #include <esp_log.h>
 #include <esp_netif.h>
+#include <esp_rom_crc.h>
 #include <esp_system.h>
+#include <esp_timer.h>
 #include <esp_tls.h>
+#include <string.h>
+#include <strings.h>
 
+#include "mem_pool.h"
 #include "util.h"
+#include "webp_stream.h"
 
 static const char* TAG = "remote";
 
+// Validators are opaque, one that doesn't fit isn't kept. An HTTP-date
+// takes 29 characters.
+#define REMOTE_VALIDATOR_MAX 64
+
+// Tronbyt-* headers the response had
+#define SEEN_BRIGHTNESS (1 << 0)
+#define SEEN_DWELL (1 << 1)
+#define SEEN_PALETTE (1 << 2)
+#define SEEN_APP (1 << 3)
+
 struct remote_state {
   void* buf;
   size_t len;
   size_t size;
   size_t max;
+  size_t total;  // Content-Length, 0 if chunked
   uint8_t brightness;
   uint8_t dwell_secs;
   uint8_t palette_mode;
+  uint8_t seen;         // SEEN_* bits
+  uint32_t app_id;      // REMOTE_APP_HEADER hashed
+  bool connected;       // Opened a connection rather than reusing one
+  int64_t t0;           // Request went out at
+  uint32_t connect_ms;  // Connect and TLS handshake
+  char etag[REMOTE_VALIDATOR_MAX];
+  char last_modified[REMOTE_VALIDATOR_MAX];
+  webp_stream_t stream;  // Shows what it can of the body as it arrives
   esp_err_t err;
 };
 
-#if !defined(HTTP_BUFFER_SIZE_MAX)
-#define HTTP_BUFFER_SIZE_MAX 512 * 1024
-#endif  // HTTP_BUFFER_SIZE_MAX
+// Kept between polls so the connection (and its TLS session) outlives a
+// request. Only remote_get uses it, from one task.
+static esp_http_client_handle_t _client;
+static char* _client_url;
+// The client keeps the TLS session of its last handshake and offers it on
+// the next connect, which then skips the key exchange and the chain check
+static bool _session;
+static uint64_t _full_ms_total, _resume_ms_total;
+static remote_stats_t _stats;
+// From the last 200: its validators, sent back so an unchanged body costs
+// a 304, and its Tronbyt-* values for a 304 that doesn't repeat them
+static char _etag[REMOTE_VALIDATOR_MAX];
+static char _last_modified[REMOTE_VALIDATOR_MAX];
+static uint8_t _brightness, _dwell_secs, _palette_mode;
+static uint32_t _app_id;
 
-#ifndef HTTP_BUFFER_SIZE_DEFAULT
-#define HTTP_BUFFER_SIZE_DEFAULT 32 * 1024
-#endif
+// Make room for need bytes, at least doubling so a chunked body (no
+// Content-Length) costs a few copies. Bulk blocks come from PSRAM where
+// there is some. The body stays contiguous, libwebp wants it that way.
+static esp_err_t grow_buffer(struct remote_state* state, size_t need) {
+  if (need > state->max) {
+    ESP_LOGE(TAG, "body exceeds allowed max (%zu bytes)", state->max);
+    return ESP_ERR_NO_MEM;
+  }
+  const size_t want = MIN(MAX(need, state->size * 2), state->max);
+  uint8_t* buf = mem_pool_alloc_bulk(want);
+  if (buf == NULL) {
+    ESP_LOGE(TAG, "couldn't grow HTTP receive buffer to %zu bytes", want);
+    return ESP_ERR_NO_MEM;
+  }
+  if (state->len) memcpy(buf, state->buf, state->len);
+  mem_pool_free(state->buf);
+  state->buf = buf;
+  state->size = MAX(mem_pool_capacity(buf), want);
+  _stats.grows++;
+  ESP_LOGI(TAG, "Grew buffer to %zu bytes at %zu received", state->size,
+           state->len);
+  return ESP_OK;
+}
+
+// Forget what a failed attempt's response left, body and headers alike, so
+// none of it passes for the retry's
+static void reset_response(struct remote_state* state) {
+  state->len = 0;
+  state->total = 0;
+  state->brightness = 0;
+  state->dwell_secs = 0;
+  state->palette_mode = 0;
+  state->seen = 0;
+  state->app_id = 0;
+  state->etag[0] = '\0';
+  state->last_modified[0] = '\0';
+  webp_stream_end(&state->stream, false);
+  webp_stream_begin(&state->stream);
+}
+
+static void copy_validator(char* dst, const char* value) {
+  if (strlen(value) < REMOTE_VALIDATOR_MAX) strcpy(dst, value);
+}
 
 static esp_err_t _httpCallback(esp_http_client_event_t* event) {
   struct remote_state* state = (struct remote_state*)event->user_data;
+  // Between requests, closing the connection still sends us events
+  if (state == NULL) {
+    return ESP_OK;
+  }
   // Bail on errors
   if (state->err != ESP_OK) {
     return state->err;
@@ -43,6 +124,8 @@ static esp_err_t _httpCallback(esp_http_client_event_t* event) {
 
     case HTTP_EVENT_ON_CONNECTED:
       ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
+      state->connected = true;
+      state->connect_ms = (esp_timer_get_time() - state->t0) / 1000;
       break;
 
     case HTTP_EVENT_HEADER_SENT:
@@ -62,7 +145,7 @@ static esp_err_t _httpCallback(esp_http_client_event_t* event) {
           ESP_LOGE(TAG,
                    "Content-Length (%zu bytes) exceeds allowed max (%zu bytes)",
                    content_length, state->max);
-          free(state->buf);
+          mem_pool_free(state->buf);
           state->buf = NULL;
           state->err = ESP_ERR_NO_MEM;
           state->size = 0;
@@ -72,35 +155,55 @@ static esp_err_t _httpCallback(esp_http_client_event_t* event) {
         } else {
           ESP_LOGI(TAG, "Content-Length Header:%zu bytes", content_length);
         }
-        // re-allocate a single time, we know our buffer size..
-        free(state->buf);
-        state->buf = malloc(content_length);
-        if (state->buf == NULL) {
-          ESP_LOGE(TAG, "Failed malloc(%zu) for Content-Length",
+        state->total = content_length;
+        // re-allocate a single time, we know our buffer size.. unless the
+        // pool block we already hold fits without wasting most of it, the
+        // body may well end up kept in the rotation
+        if (content_length > 0 &&
+            (state->buf == NULL || content_length > state->size ||
+             content_length < state->size / 2)) {
+          mem_pool_free(state->buf);
+          state->buf = mem_pool_alloc_bulk(content_length);
+          if (state->buf == NULL) {
+            ESP_LOGE(TAG, "Failed malloc(%zu) for Content-Length",
+                     content_length);
+            state->size = 0;
+            state->len = 0;
+            state->err = ESP_ERR_NO_MEM;
+            esp_http_client_close(event->client);
+            return state->err;
+          }
+          state->size = MAX(mem_pool_capacity(state->buf), content_length);
+          ESP_LOGI(TAG, "Resized buffer to Content-Length: %zu bytes",
                    content_length);
-          state->size = 0;
-          state->len = 0;
-          state->err = ESP_ERR_NO_MEM;
-          esp_http_client_close(event->client);
-          return state->err;
         }
-        state->size = content_length;
-        ESP_LOGI(TAG, "Resized buffer to Content-Length: %zu bytes",
-                 content_length);
       }
 
       // Check for our Tronbyt-* Headers
       if (strcmp(event->header_key, "Tronbyt-Brightness") == 0) {
         int brightness_pct = atoi(event->header_value);
         state->brightness = (uint8_t)(MIN(MAX(brightness_pct, 0), 100));
+        state->seen |= SEEN_BRIGHTNESS;
         ESP_LOGI(TAG, "Brightness: %s%% --> %d%%", event->header_value,
                  state->brightness);
       } else if (strcmp(event->header_key, "Tronbyt-Dwell-Secs") == 0) {
         state->dwell_secs = (uint8_t)atoi(event->header_value);
+        state->seen |= SEEN_DWELL;
         ESP_LOGI(TAG, "Dwell-Secs: %d", state->dwell_secs);
       } else if (strcmp(event->header_key, "Tronbyt-Palette") == 0) {
         state->palette_mode = (uint8_t)atoi(event->header_value);
+        state->seen |= SEEN_PALETTE;
         ESP_LOGI(TAG, "Palette: %d", state->palette_mode);
+      } else if (strcasecmp(event->header_key, REMOTE_APP_HEADER) == 0) {
+        const char* v = event->header_value;
+        state->app_id = esp_rom_crc32_le(0, (const uint8_t*)v, strlen(v));
+        if (!state->app_id) state->app_id = 1;  // 0 means none
+        state->seen |= SEEN_APP;
+        ESP_LOGI(TAG, "App: %s", v);
+      } else if (strcasecmp(event->header_key, "ETag") == 0) {
+        copy_validator(state->etag, event->header_value);
+      } else if (strcasecmp(event->header_key, "Last-Modified") == 0) {
+        copy_validator(state->last_modified, event->header_value);
       } else {
         ESP_LOGD(TAG, "Unhandled Header: %s", event->header_key);
       }
@@ -112,17 +215,30 @@ static esp_err_t _httpCallback(esp_http_client_event_t* event) {
 
     case HTTP_EVENT_ON_DATA:
       ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", event->data_len);
-      if (state->buf == NULL || state->err != ESP_OK) {
-        break;
+      if (state->buf == NULL) {
+        // No Content-Length (chunked), start from the default size
+        const size_t size = MIN(HTTP_BUFFER_SIZE_DEFAULT, state->max);
+        state->buf = mem_pool_alloc_bulk(size);
+        if (state->buf == NULL) {
+          ESP_LOGE(TAG, "couldn't allocate HTTP receive buffer");
+          state->err = ESP_ERR_NO_MEM;
+          return state->err;
+        }
+        state->size = MAX(mem_pool_capacity(state->buf), size);
       }
       if (state->len + event->data_len > state->size) {
-        ESP_LOGE(TAG, "Buffer overflow detected! len=%zu event_len=%d size=%zu",
-                 state->len, event->data_len, state->size);
-        state->err = ESP_ERR_NO_MEM;
-        return state->err;
+        // Chunked, or more than Content-Length said
+        state->err = grow_buffer(state, state->len + event->data_len);
+        if (state->err != ESP_OK) return state->err;
       }
       memcpy((uint8_t*)state->buf + state->len, event->data, event->data_len);
       state->len += event->data_len;
+      // Only an image that's going to be drawn, error pages and a dark
+      // panel aren't worth a look
+      if (esp_http_client_get_status_code(event->client) == 200 &&
+          !((state->seen & SEEN_BRIGHTNESS) && state->brightness == 0)) {
+        webp_stream_feed(&state->stream, state->buf, state->len, state->total);
+      }
       break;
 
     case HTTP_EVENT_ON_FINISH:
@@ -145,46 +261,148 @@ static esp_err_t _httpCallback(esp_http_client_event_t* event) {
   return state->err;
 }
 
+static void count_connect(const char* url, uint32_t ms) {
+  const bool tls = strncmp(url, "https:", 6) == 0;
+  const bool offered = _session;
+  if (offered) {
+    _stats.resume_offered++;
+    _resume_ms_total += ms;
+  } else {
+    _stats.full_handshakes++;
+    _full_ms_total += ms;
+  }
+  _session = tls;  // Offered on the next connect
+  ESP_LOGI(TAG, "connected in %lu ms (%s)", ms,
+           !tls ? "plain" : offered ? "resume offered" : "full handshake");
+}
+
+static void set_condition(const char* key, const char* value) {
+  if (value[0]) {
+    esp_http_client_set_header(_client, key, value);
+  } else {
+    esp_http_client_delete_header(_client, key);
+  }
+}
+
 int remote_get(const char* url, uint8_t** buf, size_t* len,
                uint8_t* brightness_pct, uint8_t* dwell_secs,
-               uint8_t* palette_mode) {
-  // State for processing the response
+               uint8_t* palette_mode, uint32_t* app_id) {
+  *buf = NULL;
+
+  // State for processing the response. The receive buffer comes with the
+  // body, a 304 doesn't need one.
   struct remote_state state = {
-      .buf = malloc(HTTP_BUFFER_SIZE_DEFAULT),
+      .buf = NULL,
       .len = 0,
-      .size = HTTP_BUFFER_SIZE_DEFAULT,
+      .size = 0,
       .max = HTTP_BUFFER_SIZE_MAX,
       .brightness = 0,
       .err = ESP_OK,
   };
 
-  if (state.buf == NULL) {
-    ESP_LOGE(TAG, "couldn't allocate HTTP receive buffer");
-    return 1;
+  // Reuse the client, and its connection if the server kept it open. A
+  // new URL keeps it too, the client reconnects if the host changed.
+  if (_client && strcmp(_client_url, url) != 0) {
+    char* copy = strdup(url);
+    if (!copy || esp_http_client_set_url(_client, url) != ESP_OK) {
+      free(copy);
+      remote_reset();
+    } else {
+      free(_client_url);
+      _client_url = copy;
+      remote_forget();
+    }
   }
+  if (!_client) {
+    esp_http_client_config_t config = {
+        .url = url,
+        .event_handler = _httpCallback,
+        .timeout_ms = 10e3,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+        .keep_alive_enable = true,    // Notice dead peers while idle
+        .save_client_session = true,  // Resume TLS on reconnects
+    };
+    _client = esp_http_client_init(&config);
+    _client_url = strdup(url);
+    if (!_client || !_client_url) {
+      ESP_LOGE(TAG, "couldn't set up HTTP client");
+      remote_reset();
+      mem_pool_free(state.buf);
+      return 1;
+    }
+  }
+  esp_http_client_set_user_data(_client, &state);
+  // Conditional GET, the server answers 304 if what we have is current
+  set_condition("If-None-Match", _etag);
+  set_condition("If-Modified-Since", _last_modified);
 
-  // Set up http client
-  esp_http_client_config_t config = {
-      .url = url,
-      .event_handler = _httpCallback,
-      .user_data = &state,
-      .timeout_ms = 10e3,
-      .crt_bundle_attach = esp_crt_bundle_attach,
-  };
-
-  esp_http_client_handle_t http = esp_http_client_init(&config);
+  // Do the request. Servers drop idle connections whenever they like, if
+  // a reused one fails go again once on a fresh one.
+  const int64_t t0 = esp_timer_get_time();
+  esp_err_t err;
+  webp_stream_begin(&state.stream);
+  for (int attempt = 0;; attempt++) {
+    state.t0 = esp_timer_get_time();
+    err = esp_http_client_perform(_client);
+    if (err == ESP_OK || state.err != ESP_OK || state.connected ||
+        attempt > 0) {
+      break;
+    }
+    ESP_LOGW(TAG, "kept connection failed (%s), reconnecting",
+             esp_err_to_name(err));
+    esp_http_client_close(_client);
+    _stats.retries++;
+    reset_response(&state);
+  }
+  const uint32_t ms = (esp_timer_get_time() - t0) / 1000;
+  _stats.requests++;
+  _stats.last_ms = ms;
+  if (state.connected) {
+    _stats.connects++;
+    count_connect(url, state.connect_ms);
+  } else {
+    _stats.reused++;
+  }
 
-  // Do the request
-  esp_err_t err = esp_http_client_perform(http);
   if (err != ESP_OK || state.err != ESP_OK) {
     ESP_LOGE(TAG, "HTTP fetch failed %s: (%s / %s) ", url, esp_err_to_name(err),
              esp_err_to_name(state.err));
-    if (state.buf != NULL) {
-      free(state.buf);
-    }
-    esp_http_client_cleanup(http);
+    _stats.failures++;
+    webp_stream_end(&state.stream, false);
+    mem_pool_free(state.buf);
+    // Whatever state the connection is in, start the next poll afresh
+    esp_http_client_set_user_data(_client, NULL);
+    esp_http_client_close(_client);
     return 1;
   }
+  esp_http_client_set_user_data(_client, NULL);
+  // Anything on the panel by now gives way to the body in gfx_rotation_take
+  webp_stream_end(&state.stream, true);
+
+  if (esp_http_client_get_status_code(_client) == 304) {
+    _stats.not_modified++;
+    mem_pool_free(state.buf);
+    ESP_LOGI(TAG, "not modified, %lu ms (%lu of %lu polls)", ms,
+             _stats.not_modified, _stats.requests);
+    *brightness_pct =
+        state.seen & SEEN_BRIGHTNESS ? MIN(state.brightness, 100) : _brightness;
+    *dwell_secs = state.seen & SEEN_DWELL ? state.dwell_secs : _dwell_secs;
+    *palette_mode =
+        state.seen & SEEN_PALETTE ? state.palette_mode : _palette_mode;
+    *app_id = state.seen & SEEN_APP ? state.app_id : _app_id;
+    return REMOTE_NOT_MODIFIED;
+  }
+  if (esp_http_client_get_status_code(_client) == 200) {
+    strcpy(_etag, state.etag);
+    strcpy(_last_modified, state.last_modified);
+    _brightness = MIN(state.brightness, 100);
+    _dwell_secs = state.dwell_secs;
+    _palette_mode = state.palette_mode;
+    _app_id = state.app_id;
+  }
+  ESP_LOGI(TAG, "%zu bytes in %lu ms on a %s connection (%lu of %lu reused)",
+           state.len, ms, state.connected ? "new" : "kept", _stats.reused,
+           _stats.requests);
 
   // Write back the results.
   *buf = state.buf;
@@ -193,8 +411,32 @@ int remote_get(const char* url, uint8_t** buf, size_t* len,
   *brightness_pct = MIN(state.brightness, 100);
   *dwell_secs = state.dwell_secs;
   *palette_mode = state.palette_mode;
-
-  esp_http_client_cleanup(http);
+  *app_id = state.app_id;
 
   return 0;
 }
+
+void remote_reset(void) {
+  if (_client) {
+    esp_http_client_set_user_data(_client, NULL);
+    esp_http_client_cleanup(_client);
+    _client = NULL;
+  }
+  free(_client_url);
+  _client_url = NULL;
+  _session = false;
+  remote_forget();
+}
+
+void remote_forget(void) {
+  _etag[0] = '\0';
+  _last_modified[0] = '\0';
+}
+
+void remote_get_stats(remote_stats_t* out) {
+  *out = _stats;
+  out->connect_ms_full =
+      _stats.full_handshakes ? _full_ms_total / _stats.full_handshakes : 0;
+  out->connect_ms_resume =
+      _stats.resume_offered ? _resume_ms_total / _stats.resume_offered : 0;
+}
@@ -4,8 +4,51 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+// Largest body we accept, mem_pool keeps a block class this size
+#ifndef HTTP_BUFFER_SIZE_MAX
+#define HTTP_BUFFER_SIZE_MAX (512 * 1024)
+#endif
+// Names the app that rendered the body, the rotation keeps one body per app
+#ifndef REMOTE_APP_HEADER
+#define REMOTE_APP_HEADER "Tronbyt-App-Id"
+#endif
+// Receive buffer a body without Content-Length starts from
+#ifndef HTTP_BUFFER_SIZE_DEFAULT
+#define HTTP_BUFFER_SIZE_DEFAULT (32 * 1024)
+#endif
+
 // Retrieves url via HTTP GET. Caller is responsible for freeing buf
-// on success.
+// on success, with mem_pool_free().
+// The connection is kept open for the next call when the server allows.
+// Requests are conditional on the last body, REMOTE_NOT_MODIFIED says it's
+// still current: no body, buf is NULL, the header values are filled in.
+// app_id hashes the REMOTE_APP_HEADER value, 0 if the server sent none.
 int remote_get(const char* url, uint8_t** buf, size_t* len,
                uint8_t* brightness_pct, uint8_t* dwell_secs,
-               uint8_t* palette_mode);
+               uint8_t* palette_mode, uint32_t* app_id);
+
+#define REMOTE_NOT_MODIFIED 2
+
+// Drop the client and its connection, the next remote_get starts afresh
+void remote_reset(void);
+// Forget the last body's validators, the next remote_get fetches it whole
+void remote_forget(void);
+
+// How well connections get reused across polls
+typedef struct remote_stats {
+  uint32_t requests;         // Requests that went out
+  uint32_t reused;           // ... on a connection kept from an earlier one
+  uint32_t connects;         // ... that had to connect (and handshake) first
+  uint32_t full_handshakes;  // Connects with no TLS session to offer
+  uint32_t resume_offered;   // ... offering the session of an earlier one
+  // Average connect times of each. Resumed handshakes take a fraction of a
+  // full one, the lower the second the more often servers resume.
+  uint32_t connect_ms_full, connect_ms_resume;
+  uint32_t not_modified;  // 304s, the body we had was still current
+  uint32_t retries;       // Kept connections the server had closed meanwhile
+  uint32_t failures;      // Requests that failed anyway
+  uint32_t grows;         // Receive buffers a body outgrew (chunked)
+  uint32_t last_ms;       // Time the last request took
+} remote_stats_t;
+
+void remote_get_stats(remote_stats_t* out);
@@ -0,0 +1,29 @@
+// Route libwebp's allocations (decoder canvases, demuxer, VP8/VP8L working
+// memory) through mem_pool. Hooked at link time with
+// -Wl,--wrap=<symbol>, see build_flags in platformio.ini.
+//
+// Calls inside libwebp's utils.c don't go through the wrappers, so pointers
+// from the real allocator can reach __wrap_WebPSafeFree. mem_pool_free()
+// hands those back to the heap.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mem_pool.h"
+
+void *__wrap_WebPSafeMalloc(uint64_t nmemb, size_t size) {
+  const uint64_t total = nmemb * (uint64_t)size;
+  if (size && nmemb > SIZE_MAX / size) return NULL;
+  return mem_pool_alloc((size_t)total);
+}
+
+void *__wrap_WebPSafeCalloc(uint64_t nmemb, size_t size) {
+  if (nmemb > SIZE_MAX) return NULL;
+  return mem_pool_calloc((size_t)nmemb, size);
+}
+
+void __wrap_WebPSafeFree(void *const ptr) { mem_pool_free(ptr); }
+
+void *__wrap_WebPMalloc(size_t size) { return mem_pool_alloc(size); }
+
+void __wrap_WebPFree(void *ptr) { mem_pool_free(ptr); }
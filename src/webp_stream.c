@@ -0,0 +1,151 @@
+#include "webp_stream.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <string.h>
+#include <webp/demux.h>
+
+#include "display.h"
+#include "gfx.h"
+#include "mem_pool.h"
+#include "util.h"
+
+static const char *TAG = "webp_stream";
+
+void webp_stream_begin(webp_stream_t *s) {
+  memset(s, 0, sizeof(*s));
+  s->t0 = esp_timer_get_time();
+}
+
+static void stream_show(webp_stream_t *s, size_t len, size_t total) {
+  if (gfx_show_preview(s->rgba, s->width, s->height) != 0) {
+    s->done = true;  // The rotation is playing, the body waits its turn
+    return;
+  }
+  if (!s->shown) {
+    ESP_LOGI(TAG, "first preview %lu ms in, %zu of %zu bytes",
+             (uint32_t)((esp_timer_get_time() - s->t0) / 1000), len, total);
+  }
+  s->shown = true;
+  s->shown_us = esp_timer_get_time();
+}
+
+static bool stream_start(webp_stream_t *s, const uint8_t *buf, size_t len) {
+  WebPDecoderConfig config;
+  if (!WebPInitDecoderConfig(&config)) return false;
+  VP8StatusCode st = WebPGetFeatures(buf, len, &config.input);
+  if (st == VP8_STATUS_NOT_ENOUGH_DATA) return true;  // Try again later
+  if (st != VP8_STATUS_OK) return false;
+
+  s->started = true;
+  s->animated = config.input.has_animation;
+  s->width = MIN(config.input.width, DISPLAY_WIDTH);
+  s->height = MIN(config.input.height, DISPLAY_HEIGHT);
+  const size_t bytes = (size_t)s->width * s->height * 4;
+  s->rgba = mem_pool_calloc(1, bytes);
+  if (!s->rgba) return false;
+  if (s->animated) return true;
+
+  // Rows land straight in the canvas, cropped to the panel as the decode
+  // stage would
+  if (s->width != config.input.width || s->height != config.input.height) {
+    config.options.use_cropping = 1;
+    config.options.crop_width = s->width;
+    config.options.crop_height = s->height;
+  }
+  config.output.colorspace = MODE_rgbA;
+  config.output.is_external_memory = 1;
+  config.output.u.RGBA.rgba = s->rgba;
+  config.output.u.RGBA.stride = s->width * 4;
+  config.output.u.RGBA.size = bytes;
+  s->idec = WebPIDecode(NULL, 0, &config);
+  return s->idec != NULL;
+}
+
+// Still: show the rows decoded so far, now and then
+static void stream_rows(webp_stream_t *s, const uint8_t *buf, size_t len,
+                        size_t total) {
+  VP8StatusCode st = WebPIUpdate(s->idec, buf, len);
+  if (st != VP8_STATUS_SUSPENDED) {
+    s->done = true;  // Complete (the rotation takes it from here) or broken
+    return;
+  }
+  int last_y = 0;
+  WebPIDecGetRGB(s->idec, &last_y, NULL, NULL, NULL);
+  if (last_y > s->rows &&
+      esp_timer_get_time() - s->shown_us >= WEBP_STREAM_PREVIEW_MS * 1000) {
+    s->rows = last_y;
+    stream_show(s, len, total);
+  }
+}
+
+// Animation: once the first frame's chunk is all there, decode it onto the
+// cleared canvas, which is all it's blended with
+static void stream_frame1(webp_stream_t *s, const uint8_t *buf, size_t len,
+                          size_t total) {
+  // Demuxing from the top each time, so look only every few KB
+  if (len - s->tried < 4096) return;
+  s->tried = len;
+
+  WebPData data = {.bytes = buf, .size = len};
+  WebPDemuxState state;
+  WebPDemuxer *dmux = WebPDemuxPartial(&data, &state);
+  if (!dmux) {
+    s->done = state == WEBP_DEMUX_PARSE_ERROR;
+    return;
+  }
+  WebPIterator it;
+  if (WebPDemuxGetFrame(dmux, 1, &it)) {
+    if (it.complete) {
+      s->done = true;
+      WebPDecoderConfig config;
+      uint8_t *px = mem_pool_alloc((size_t)it.width * it.height * 4);
+      if (px && WebPInitDecoderConfig(&config)) {
+        config.output.colorspace = MODE_rgbA;
+        config.output.is_external_memory = 1;
+        config.output.u.RGBA.rgba = px;
+        config.output.u.RGBA.stride = it.width * 4;
+        config.output.u.RGBA.size = (size_t)it.width * it.height * 4;
+        if (WebPDecode(it.fragment.bytes, it.fragment.size, &config) ==
+            VP8_STATUS_OK) {
+          for (int y = 0; y < it.height && it.y_offset + y < s->height; y++) {
+            const int w = MIN(it.width, s->width - it.x_offset);
+            if (w <= 0) break;
+            memcpy(s->rgba + ((it.y_offset + y) * s->width + it.x_offset) * 4,
+                   px + y * it.width * 4, w * 4);
+          }
+          stream_show(s, len, total);
+        }
+      }
+      mem_pool_free(px);
+    }
+    WebPDemuxReleaseIterator(&it);
+  }
+  WebPDemuxDelete(dmux);
+}
+
+void webp_stream_feed(webp_stream_t *s, const uint8_t *buf, size_t len,
+                      size_t total) {
+  if (s->done) return;
+  if (total && len + WEBP_STREAM_MIN_REMAINING > total) {
+    s->done = true;  // Almost there, not worth a preview
+    return;
+  }
+  if (!s->started && !stream_start(s, buf, len)) {
+    s->done = true;
+    return;
+  }
+  if (!s->started) return;
+  if (s->animated) {
+    stream_frame1(s, buf, len, total);
+  } else {
+    stream_rows(s, buf, len, total);
+  }
+}
+
+void webp_stream_end(webp_stream_t *s, bool ok) {
+  if (s->idec) WebPIDelete(s->idec);
+  mem_pool_free(s->rgba);
+  if (s->shown && !ok) gfx_cancel_preview();
+  memset(s, 0, sizeof(*s));
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+// Looks at a WebP body while it downloads and puts what it can on the panel
+// before the last byte is in: a still's rows as they decode, an animation's
+// first frame once its ANMF chunk is complete. The finished body still goes
+// through the rotation, this only shortens the wait for it.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <webp/decode.h>
+
+// Bodies this close to complete are left to the rotation, a preview would
+// be replaced before anyone saw it
+#ifndef WEBP_STREAM_MIN_REMAINING
+#define WEBP_STREAM_MIN_REMAINING (16 * 1024)
+#endif
+
+// Shortest time between two previews of a still's rows
+#ifndef WEBP_STREAM_PREVIEW_MS
+#define WEBP_STREAM_PREVIEW_MS 100
+#endif
+
+typedef struct webp_stream {
+  WebPIDecoder *idec;      // Still: incremental decoder over the body so far
+  uint8_t *rgba;           // Panel sized canvas, rgbA like the decode stage
+  uint16_t width, height;  // Image cropped to the panel
+  int rows;                // Still: rows decoded by the last preview
+  size_t tried;            // Animation: body length at the last look
+  int64_t t0, shown_us;    // Started at, last preview at
+  bool started;            // Headers parsed
+  bool animated;
+  bool shown;              // A preview is on the panel
+  bool done;               // Nothing more to show, or not worth it
+} webp_stream_t;
+
+void webp_stream_begin(webp_stream_t *s);
+// buf holds the first len bytes of a total byte body, 0 if not known. buf
+// may move between calls as it grows.
+void webp_stream_feed(webp_stream_t *s, const uint8_t *buf, size_t len,
+                      size_t total);
+// ok says the body arrived whole and goes to the rotation. If not, a
+// preview on the panel makes way for what was there before.
+void webp_stream_end(webp_stream_t *s, bool ok);